@@ -0,0 +1,85 @@
+//
+//  AUTDeferredRouter.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import ReactiveObjC;
+
+#import <AUTRouting/NSURL+AUTRouting.h>
+
+@class AUTRouter;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Accepts URLs before the router that should route to them exists, e.g. URLs
+/// that are opened at launch before the root of the routing tree is built.
+///
+/// URLs are buffered until a router is attached, after which they are routed to
+/// one at a time in the order that they were received. Once every buffered URL
+/// has been routed to, URLs are forwarded to the router's handleURL command.
+@interface AUTDeferredRouter : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param capacity The maximum number of URLs that are buffered before a
+///        router is attached. Must be greater than zero.
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// The maximum number of URLs that are buffered before a router is attached.
+///
+/// Once at capacity, the oldest buffered URL is dropped to make room for a more
+/// recent URL, erroring in the AUTRoutingErrorDomain domain with the
+/// AUTRoutingErrorCodeDropped code.
+@property (readonly, nonatomic) NSUInteger capacity;
+
+/// The options that buffered URLs are tokenized with, which should match those
+/// of the router that is attached, as buffered URLs are routed to with the
+/// components that they were tokenized into.
+///
+/// Defaults to none.
+@property (atomic) AUTRoutingTokenizerOptions tokenizerOptions;
+
+/// Like -[AUTRouter handleURL], but buffers the URL if no router has been
+/// attached to the receiver yet.
+///
+/// Buffered URLs are tokenized when they are received, so a URL with no
+/// routable components errors immediately in the AUTRoutingErrorDomain domain
+/// with the AUTRoutingErrorCodeInvalidURL code. A URL with the same routing
+/// components, query and context object as a URL that is already buffered is
+/// not buffered again; its execution signal instead shares the outcome of the
+/// buffered URL.
+///
+/// Always enabled, as URLs are buffered rather than rejected.
+@property (readonly, nonatomic) RACCommand<RACTwoTuple<NSURL *, id> *, RACTwoTuple<NSURL *, id> *> *handleURL;
+
+/// Returns a signal that routes to the provided URL when subscribed to, or
+/// buffers it as the handleURL command does.
+///
+/// Unlike the executions of the handleURL command, a buffered URL can be
+/// cancelled: once every subscription to it has been disposed, it is removed
+/// from the buffer. URLs that have begun routing are not cancelled.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url context:(nullable id)context;
+
+/// The router that the receiver has been attached to, or nil if it has not yet
+/// been attached to one.
+@property (readonly, atomic, nullable) AUTRouter *router;
+
+/// Attaches the receiver to the provided router, routing to each of the
+/// buffered URLs in order.
+///
+/// Buffered URLs are routed to without the router's handleURL command, so are
+/// not subject to its concurrency policy. An exception is thrown if the
+/// receiver has already been attached to a router.
+- (void)attachRouter:(AUTRouter *)router;
+
+/// The number of URLs that are waiting to be routed to.
+@property (readonly, atomic) NSUInteger bufferedURLCount;
+
+/// The number of URLs that were dropped while at capacity.
+@property (readonly, atomic) NSUInteger droppedCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
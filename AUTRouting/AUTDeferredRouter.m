@@ -0,0 +1,337 @@
+//
+//  AUTDeferredRouter.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+#import "AUTLog.h"
+#import "AUTRouter_Private.h"
+#import "AUTRoutingErrors.h"
+
+#import "AUTDeferredRouter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSError *BufferingError(NSString *reason, AUTRoutingErrorCode code, NSURL *url, id _Nullable context) {
+    AUTCAssertNotNil(reason, url);
+
+    let userInfo = (NSMutableDictionary<NSString *, id> *)[NSMutableDictionary dictionaryWithDictionary:@{
+        NSLocalizedDescriptionKey: @"Routing failed",
+        NSLocalizedFailureReasonErrorKey: reason,
+        AUTRoutingErrorURLKey: url,
+    }];
+
+    if (context != nil) {
+        userInfo[AUTRoutingErrorContextKey] = context;
+    }
+
+    return [NSError errorWithDomain:AUTRoutingErrorDomain code:code userInfo:userInfo];
+}
+
+/// A URL that is waiting for a router to be attached.
+@interface AUTBufferedRouting : NSObject
+
+@property (readonly, nonatomic) NSURL *URL;
+
+@property (readonly, nonatomic, nullable) id context;
+
+/// The routing components of the URL.
+@property (readonly, nonatomic, copy) NSArray<NSString *> *components;
+
+/// Replays the outcome of routing to the URL.
+@property (readonly, nonatomic) RACReplaySubject<RACTwoTuple<NSURL *, id> *> *outcome;
+
+/// The number of subscriptions to the outcome that have not been disposed.
+/// Guarded by the buffered routings of the deferred router.
+@property (nonatomic) NSUInteger subscriberCount;
+
+/// Whether routing to the provided URL with the given context would be
+/// identical to routing to the receiver's URL with its context.
+- (BOOL)isEquivalentToURL:(NSURL *)url components:(NSArray<NSString *> *)components context:(nullable id)context;
+
+@end
+
+@implementation AUTBufferedRouting
+
+- (instancetype)initWithURL:(NSURL *)url context:(nullable id)context components:(NSArray<NSString *> *)components {
+    self = [super init];
+
+    _URL = url;
+    _context = context;
+    _components = [components copy];
+    _outcome = [RACReplaySubject subject];
+
+    return self;
+}
+
+- (BOOL)isEquivalentToURL:(NSURL *)url components:(NSArray<NSString *> *)components context:(nullable id)context {
+    AUTAssertNotNil(url, components);
+
+    if (![self.components isEqualToArray:components]) return NO;
+    if (self.context != context && ![self.context isEqual:context]) return NO;
+
+    let query = self.URL.query;
+    let otherQuery = url.query;
+    if (query == nil || otherQuery == nil) return query == otherQuery;
+
+    return [AUTNotNil(query) isEqualToString:AUTNotNil(otherQuery)];
+}
+
+@end
+
+@interface AUTDeferredRouter ()
+
+/// The buffered routings in the order that they were received. Also guards the
+/// receiver's router, metrics and whether it is draining.
+@property (readonly, nonatomic) NSMutableArray<AUTBufferedRouting *> *bufferedRoutings;
+
+@end
+
+@implementation AUTDeferredRouter {
+    AUTRouter * _Nullable _router;
+
+    /// Whether buffered routings are still being routed to after a router was
+    /// attached, during which new URLs continue to be buffered.
+    BOOL _draining;
+
+    NSUInteger _droppedCount;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    NSParameterAssert(capacity > 0);
+
+    self = [super init];
+
+    _capacity = capacity;
+    _bufferedRoutings = [NSMutableArray array];
+    _handleURL = [self createHandleURLCommand];
+
+    return self;
+}
+
+#pragma mark - AUTDeferredRouter
+
+- (RACCommand<RACTwoTuple<NSURL *, id> *, RACTwoTuple<NSURL *, id> *> *)createHandleURLCommand {
+    @weakify(self);
+
+    let command = [[RACCommand alloc] initWithSignalBlock:^(RACTwoTuple<NSURL *, id> *urlAndContext) {
+        @strongifyOr(self) return [RACSignal empty];
+
+        return [self routingSignalForURL:AUTNotNil(urlAndContext.first) context:urlAndContext.second];
+    }];
+
+    command.allowsConcurrentExecution = YES;
+
+    return command;
+}
+
+- (nullable AUTRouter *)router {
+    @synchronized (self.bufferedRoutings) {
+        return _router;
+    }
+}
+
+- (void)attachRouter:(AUTRouter *)router {
+    AUTAssertNotNil(router);
+
+    @synchronized (self.bufferedRoutings) {
+        NSAssert(_router == nil, @"%@ is already attached to %@", self, _router);
+
+        _router = router;
+        _draining = YES;
+    }
+
+    [self routeBufferedRoutings];
+}
+
+- (NSUInteger)bufferedURLCount {
+    @synchronized (self.bufferedRoutings) {
+        return self.bufferedRoutings.count;
+    }
+}
+
+- (NSUInteger)droppedCount {
+    @synchronized (self.bufferedRoutings) {
+        return _droppedCount;
+    }
+}
+
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url context:(nullable id)context {
+    AUTAssertNotNil(url);
+
+    @weakify(self);
+
+    return [RACSignal createSignal:^ RACDisposable * _Nullable (id<RACSubscriber> subscriber) {
+        @strongify(self);
+        if (self == nil) {
+            [subscriber sendCompleted];
+            return nil;
+        }
+
+        AUTRouter * _Nullable router;
+        AUTBufferedRouting * _Nullable droppedRouting;
+        AUTBufferedRouting * _Nullable routing;
+
+        @synchronized (self.bufferedRoutings) {
+            if (self->_router != nil && !self->_draining) {
+                router = self->_router;
+            } else {
+                let components = [url aut_routingComponentsWithOptions:self.tokenizerOptions];
+                if (components.count == 0) {
+                    AUTLogRoutingError(@"%@ unable to buffer route to %@, no components could be extracted", self, url);
+
+                    [subscriber sendError:BufferingError(@"URL is not routable", AUTRoutingErrorCodeInvalidURL, url, context)];
+                    return nil;
+                }
+
+                for (AUTBufferedRouting *bufferedRouting in self.bufferedRoutings) {
+                    if ([bufferedRouting isEquivalentToURL:url components:components context:context]) {
+                        routing = bufferedRouting;
+                        break;
+                    }
+                }
+
+                if (routing == nil) {
+                    if (self.bufferedRoutings.count >= self.capacity) {
+                        droppedRouting = self.bufferedRoutings.firstObject;
+                        [self.bufferedRoutings removeObjectAtIndex:0];
+                        self->_droppedCount++;
+                    }
+
+                    routing = [[AUTBufferedRouting alloc] initWithURL:url context:context components:components];
+                    [self.bufferedRoutings addObject:AUTNotNil(routing)];
+                }
+
+                AUTNotNil(routing).subscriberCount++;
+            }
+        }
+
+        if (router != nil) {
+            return [[router.handleURL execute:RACTuplePack(url, context)] subscribe:subscriber];
+        }
+
+        if (droppedRouting != nil) {
+            AUTLogRoutingInfo(@"%@ dropped buffered routing to %@ at capacity", self, droppedRouting.URL);
+
+            [droppedRouting.outcome sendError:BufferingError(@"The routing buffer is at capacity", AUTRoutingErrorCodeDropped, droppedRouting.URL, droppedRouting.context)];
+        }
+
+        let bufferedRouting = AUTNotNil(routing);
+        let disposable = [bufferedRouting.outcome subscribe:subscriber];
+
+        return [RACDisposable disposableWithBlock:^{
+            [disposable dispose];
+
+            @strongifyOr(self) return;
+            [self unsubscribeFromBufferedRouting:bufferedRouting];
+        }];
+    }];
+}
+
+#pragma mark - Private
+
+/// Removes the provided routing from the buffer once its last subscription has
+/// been disposed, unless it has already begun routing.
+- (void)unsubscribeFromBufferedRouting:(AUTBufferedRouting *)routing {
+    AUTAssertNotNil(routing);
+
+    @synchronized (self.bufferedRoutings) {
+        routing.subscriberCount--;
+        if (routing.subscriberCount > 0) return;
+
+        let index = [self.bufferedRoutings indexOfObjectIdenticalTo:routing];
+        if (index == NSNotFound) return;
+
+        [self.bufferedRoutings removeObjectAtIndex:index];
+    }
+
+    AUTLogRoutingInfo(@"%@ cancelled buffered routing to %@", self, routing.URL);
+}
+
+/// Routes to each buffered routing in turn, oldest first, until none remain.
+- (void)routeBufferedRoutings {
+    [[self drainBufferedRoutings] subscribeCompleted:^{}];
+}
+
+/// Returns a signal that concatenates a routing for each URL that is buffered
+/// when subscribed to, followed by a routing for each URL that was buffered
+/// while those were being routed to, and so on until none remain.
+///
+/// Each routing is only removed from the buffer once the routing before it
+/// finishes, so that it can be cancelled until it begins.
+- (RACSignal *)drainBufferedRoutings {
+    @weakify(self);
+
+    return [RACSignal defer:^{
+        @strongifyOr(self) return [RACSignal empty];
+
+        NSUInteger count;
+
+        @synchronized (self.bufferedRoutings) {
+            count = self.bufferedRoutings.count;
+
+            if (count == 0) {
+                self->_draining = NO;
+                return [RACSignal empty];
+            }
+        }
+
+        let routings = [NSMutableArray<RACSignal *> arrayWithCapacity:count + 1];
+        for (NSUInteger index = 0; index < count; index++) {
+            [routings addObject:[self routeOldestBufferedRouting]];
+        }
+
+        [routings addObject:[self drainBufferedRoutings]];
+
+        return [RACSignal concat:routings];
+    }];
+}
+
+/// Returns a signal that removes the oldest buffered routing when subscribed
+/// to and routes to it, forwarding the outcome to its subscribers.
+///
+/// Never errors, so that the routings after it are still routed to.
+- (RACSignal *)routeOldestBufferedRouting {
+    @weakify(self);
+
+    return [RACSignal defer:^{
+        @strongifyOr(self) return [RACSignal empty];
+
+        AUTRouter *router;
+        AUTBufferedRouting *routing;
+
+        @synchronized (self.bufferedRoutings) {
+            // Buffered routings may have been cancelled since the drain began.
+            if (self.bufferedRoutings.count == 0) return [RACSignal empty];
+
+            router = AUTNotNil(self->_router);
+            routing = self.bufferedRoutings.firstObject;
+            [self.bufferedRoutings removeObjectAtIndex:0];
+        }
+
+        let outcome = routing.outcome;
+
+        return [[[[[router routingSignalForURL:routing.URL components:routing.components context:routing.context]
+            doNext:^(RACTwoTuple<NSURL *, id> *urlAndContext) {
+                [outcome sendNext:urlAndContext];
+            }]
+            doError:^(NSError *error) {
+                [outcome sendError:error];
+            }]
+            doCompleted:^{
+                [outcome sendCompleted];
+            }]
+            ignoreValues]
+            catchTo:[RACSignal empty]];
+    }];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -9,6 +9,7 @@
 @import Foundation;
 
 @class AUTRoutes;
+@class AUTStaticRouteTable;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -24,4 +25,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+/// Describes a class whose instances can participate in routing with a single
+/// set of routes that is shared between all of them, in place of each
+/// instance building its own routes.
+///
+/// Instances of conforming classes can be sent wherever a routable is
+/// expected. If a class conforms to both this protocol and AUTRoutable, the
+/// routes of each instance are used instead.
+@protocol AUTTemplateRoutable <NSObject>
+
+/// The routes that every instance of the receiving class can handle.
+///
+/// When routing to an instance, the table's handlers are invoked with the
+/// instance as their target. The routes are created once per class.
+@property (class, readonly, nonatomic) AUTStaticRouteTable *routeTemplate;
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,41 @@
+//
+//  AUTRoutableConformance.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The routing protocol that the class of an object conforms to.
+typedef NS_ENUM(NSUInteger, AUTRoutableConformance) {
+    /// The class conforms to neither AUTRoutable nor AUTTemplateRoutable.
+    AUTRoutableConformanceNone = 0,
+
+    /// The class conforms to AUTRoutable, whether or not it also conforms to
+    /// AUTTemplateRoutable.
+    AUTRoutableConformanceRoutable = 1,
+
+    /// The class conforms to AUTTemplateRoutable but not to AUTRoutable.
+    AUTRoutableConformanceTemplateRoutable = 2,
+};
+
+/// Returns the routing protocol that the class of the provided object conforms
+/// to.
+///
+/// The conformance of each class is checked against the runtime once, and then
+/// read from a lock-free table, so routing to many instances of the same class
+/// is charged a single conformance check.
+///
+/// @param object The object to check, which is not routable if nil.
+FOUNDATION_EXTERN AUTRoutableConformance AUTRoutableConformanceOfObject(id _Nullable object);
+
+/// Returns whether the class of the provided object conforms to AUTRoutable or
+/// AUTTemplateRoutable.
+///
+/// @see AUTRoutableConformanceOfObject
+FOUNDATION_EXTERN BOOL AUTIsRoutable(id _Nullable object);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,80 @@
+//
+//  AUTRoutableConformance.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import ObjectiveC.runtime;
+
+#import <stdatomic.h>
+
+#import "AUTExtObjC.h"
+#import "AUTRoutable.h"
+
+#import "AUTRoutableConformance.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The number of entries in the conformance table, which must be a power of
+/// two.
+static const NSUInteger ConformanceTableCapacity = 1024;
+
+/// The number of entries that are probed for a class before falling back to an
+/// uncached check, bounding lookups if the table is nearly full.
+static const NSUInteger ConformanceTableMaximumProbeCount = 16;
+
+/// The bits of an entry that hold the AUTRoutableConformance of its class.
+/// Classes are at least 8-byte aligned, so the low bits of their addresses are
+/// free.
+static const uintptr_t ConformanceMask = 3;
+
+/// An open-addressed table of classes, each with its conformance in the low
+/// bits, or zero if empty. Entries are only ever written once, from zero, so
+/// readers never observe a partially written entry.
+static _Atomic(uintptr_t) ConformanceTable[ConformanceTableCapacity];
+
+static inline AUTRoutableConformance ClassConformance(Class class) {
+    if ([class conformsToProtocol:@protocol(AUTRoutable)]) return AUTRoutableConformanceRoutable;
+    if ([class conformsToProtocol:@protocol(AUTTemplateRoutable)]) return AUTRoutableConformanceTemplateRoutable;
+
+    return AUTRoutableConformanceNone;
+}
+
+BOOL AUTIsRoutable(id _Nullable object) {
+    return AUTRoutableConformanceOfObject(object) != AUTRoutableConformanceNone;
+}
+
+AUTRoutableConformance AUTRoutableConformanceOfObject(id _Nullable object) {
+    if (object == nil) return AUTRoutableConformanceNone;
+
+    let class = object_getClass(object);
+    let key = (uintptr_t)(__bridge void *)class;
+    NSCAssert((key & ConformanceMask) == 0, @"Classes must be aligned, this is programmer error");
+
+    var index = (NSUInteger)((key >> 3) ^ (key >> 13)) & (ConformanceTableCapacity - 1);
+
+    for (NSUInteger probe = 0; probe < ConformanceTableMaximumProbeCount; probe++) {
+        var entry = atomic_load_explicit(&ConformanceTable[index], memory_order_acquire);
+
+        if (entry == 0) {
+            let conformance = ClassConformance(class);
+            let newEntry = key | (uintptr_t)conformance;
+
+            if (atomic_compare_exchange_strong_explicit(&ConformanceTable[index], &entry, newEntry, memory_order_acq_rel, memory_order_acquire)) {
+                return conformance;
+            }
+
+            // Another thread claimed the entry first, and populated entry with
+            // the class that it claimed it for.
+        }
+
+        if ((entry & ~ConformanceMask) == key) return (AUTRoutableConformance)(entry & ConformanceMask);
+
+        index = (index + 1) & (ConformanceTableCapacity - 1);
+    }
+
+    return ClassConformance(class);
+}
+
+NS_ASSUME_NONNULL_END
@@ -30,6 +30,18 @@ NS_ASSUME_NONNULL_BEGIN
 /// "custom:/user/1234/", where "1234" would be the value for the "user_id" key
 /// passed into the handler block.
 ///
+/// Route path components may be followed by query keys that the route expects
+/// in the URL's query string. Required query keys are denoted by a leading
+/// question mark, e.g. "?tab", and optional query keys are additionally
+/// wrapped in brackets, e.g. "?[ref]". Query key values are passed into the
+/// handler block alongside the dynamic component values, and a route does not
+/// match a URL that is missing any of its required query keys.
+///
+/// For example, the route [ "inbox", "?tab", "?[ref]" ] would match the URL
+/// "custom:/inbox?tab=2&ref=push", where "2" would be the value for the "tab"
+/// key and "push" would be the value for the "ref" key passed into the handler
+/// block. It would not match the URL "custom:/inbox?ref=push".
+///
 /// Routes may also require a context object that contains additional data that
 /// is not encoded into the URL as a string. If a context object is required to
 /// handle a specific route, it can be specified when building a route. The
@@ -43,6 +55,19 @@ NS_ASSUME_NONNULL_BEGIN
 /// block that returns a signal.
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components signal:(RACSignal<id<AUTRoutable>> *)signal;
 
+/// Initializes a route that executes the provided command with the given input
+/// when it is handled, subscribing to the command's execution signal directly.
+///
+/// The first value that the execution signal sends is the next routable, and
+/// the subscription to the execution signal is disposed once it is sent, in
+/// case the execution signal has a longer lifecycle. If the first value does
+/// not conform to AUTRoutable, routing ends at the route.
+///
+/// @param command The command to execute, which is not retained, as it is
+///        typically owned by the routable that owns the route. Handling the
+///        route has no effect once it deallocates.
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components command:(RACCommand *)command input:(nullable id)input;
+
 /// Like AUTRouteWithContextHandlerBlock but without a context.
 ///
 /// @see AUTRouteWithContextHandlerBlock
@@ -70,6 +95,11 @@ typedef RACSignal<id<AUTRoutable>> * _Nonnull (^AUTRouteWithSingleTokenHandlerBl
 /// path components @[ @"identifier", @"1234" ] where @"1234" would be passed
 /// into the handler block.
 ///
+/// The token follows the path components, so query keys may still be declared
+/// after them (e.g. @[ @"identifier", @"?tab" ]). Their values are not passed
+/// into the handler block, but required query keys must still be present for
+/// the route to match.
+///
 /// @param components The route pattern to be matched. An exception is thrown if
 ///        a zero-element array is provided.
 ///
@@ -108,11 +138,98 @@ typedef RACSignal<id<AUTRoutable>> * _Nonnull (^AUTRouteWithContextHandlerBlock)
 ///        been handled or errors out otherwise
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components contextClass:(Class)contextClass handler:(AUTRouteWithContextHandlerBlock)handler;
 
-/// The path components that make up the receiver's route.
+/// Adds a handler for context objects of another class to a route that was
+/// initialized with -initWithComponents:contextClass:handler:.
+///
+/// When the receiver is matched, the handler registered for the closest
+/// ancestor of the context object's class is invoked. The resolved handler is
+/// cached per class, so dispatch is a single lookup once a class has been
+/// routed with. Routing only errors with the
+/// AUTRoutingErrorCodeWrongContextObjectClass code if no handler fits.
+///
+/// @return Whether the handler was added. NO if the receiver does not require
+///         a context object, or already has a handler for the context class.
+- (BOOL)addHandler:(AUTRouteWithContextHandlerBlock)handler forContextClass:(Class)contextClass;
+
+/// The path components that make up the receiver's route, followed by any query
+/// keys that it declares.
 ///
-/// Contains at least one component.
+/// Contains at least one path component.
 @property (nonatomic, copy, readonly) NSArray<NSString *> *components;
 
+/// An identifier for the receiver that is unique among the routes of an
+/// AUTRoutes, formed by joining its components with "/", e.g. "user/:user_id".
+@property (nonatomic, copy, readonly) NSString *identifier;
+
+/// Generates a URL that the receiver matches, the inverse of routing.
+///
+/// Dynamic components and query keys are populated from the values of their
+/// keys in the parameters, and are percent-encoded such that routing to the
+/// URL passes the same values to the receiver's handler. The URL has no host,
+/// e.g. "custom:/user/1234?tab=2".
+///
+/// The receiver's pattern is compiled once, so generating many URLs from a
+/// route only encodes their parameters.
+///
+/// @return The URL, or nil if a dynamic component or required query key has no
+///         value in the parameters, or a dynamic component's value is empty.
+- (nullable NSURL *)URLWithScheme:(NSString *)scheme parameters:(NSDictionary<NSString *, NSString *> *)parameters;
+
+/// Like -URLWithScheme:parameters:, but generates a URL that is routed through
+/// each of the provided routes in order, e.g. a tab's route followed by the
+/// route of a screen within it.
+///
+/// Parameters are shared between all of the routes.
++ (nullable NSURL *)URLWithScheme:(NSString *)scheme routes:(NSArray<AUTRoute *> *)routes parameters:(NSDictionary<NSString *, NSString *> *)parameters;
+
+/// The scheduler that the receiver's handler is invoked on when routing with a
+/// router that has a matching scheduler, overriding the router's handler
+/// scheduler.
+///
+/// Has no effect when routing with a router without a matching scheduler.
+/// Defaults to nil.
+@property (atomic, nullable) RACScheduler *scheduler;
+
+/// Whether the receiver's handler always sends the same next routable for the
+/// same parameters, e.g. a route that switches to a long-lived tab.
+///
+/// The next routable sent by an idempotent route's handler is cached per set of
+/// parameters, and is sent in place of invoking the handler when the same
+/// parameters are matched again. Context objects are not considered. Cached
+/// routables are held weakly, so a cached routable that has been deallocated
+/// results in the handler being invoked again.
+///
+/// Defaults to NO.
+@property (atomic, getter=isIdempotent) BOOL idempotent;
+
+/// Whether the receiver's handler may send several next routables, each of
+/// which is routed to concurrently as a separate branch, e.g. to update both
+/// the master and detail of a split view from a single URL.
+///
+/// By default each branch handles the components that remain after the
+/// receiver. A branch is instead routed with its own slice of components if
+/// the handler sends an AUTRoutingBranch in place of the routable. Routing
+/// succeeds once the handler's signal and every branch have completed, and
+/// fails as soon as any branch fails.
+///
+/// Otherwise only the first next routable that the handler sends is routed
+/// to. Fan-out routes never cache their next routables, even if idempotent,
+/// and are not recorded in routing snapshots.
+///
+/// Defaults to NO.
+@property (atomic) BOOL fansOut;
+
+/// The amount of time that a cached next routable is used for before the
+/// handler is invoked again, or zero for no limit. Only applies if the receiver
+/// is idempotent.
+///
+/// Defaults to zero.
+@property (atomic) NSTimeInterval cachedRoutableLifetime;
+
+/// Discards all next routables cached by an idempotent receiver, so that its
+/// handler is invoked the next time it is matched.
+- (void)removeCachedRoutables;
+
 @end
 
 NS_ASSUME_NONNULL_END
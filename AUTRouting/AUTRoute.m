@@ -6,18 +6,143 @@
 //  Copyright © 2015 Automatic Labs. All rights reserved.
 //
 
+@import ObjectiveC.runtime;
 @import ReactiveObjC;
 
+#import <malloc/malloc.h>
+#import <stdatomic.h>
+
 #import "AUTExtObjC.h"
+#import "AUTRoutableConformance.h"
+#import "AUTRoutingBranch.h"
 #import "AUTRoutingErrors.h"
+#import "AUTRoutingRestorationContext.h"
+#import "AUTRouteTemplate.h"
+#import "AUTRoutingTime.h"
+#import "NSURL+AUTRouting.h"
 
 #import "AUTRoute_Private.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 static let DynamicPrefix = @":";
+static let QueryKeyPrefix = @"?";
+
+/// Returns the query key declared by the provided pattern component, or nil if
+/// it is a path component.
+///
+/// @param isOptional Populated with whether the key is optional.
+static NSString * _Nullable QueryKey(NSString *component, BOOL *isOptional) {
+    if (![component hasPrefix:QueryKeyPrefix]) return nil;
+
+    let key = [component substringFromIndex:QueryKeyPrefix.length];
+
+    *isOptional = (key.length > 2 && [key hasPrefix:@"["] && [key hasSuffix:@"]"]);
+    if (*isOptional) return [key substringWithRange:NSMakeRange(1, key.length - 2)];
+
+    return key;
+}
+
+/// A next routable sent by the handler of an idempotent route.
+@interface AUTRouteCachedRoutable : NSObject
+
+- (instancetype)initWithRoutable:(id<AUTRoutable>)routable expirationTime:(NSTimeInterval)expirationTime;
+
+@property (readonly, nonatomic, weak) id<AUTRoutable> routable;
+
+/// The monotonic time after which the routable should no longer be used, or
+/// zero if it does not expire.
+@property (readonly, nonatomic) NSTimeInterval expirationTime;
+
+@end
+
+@implementation AUTRouteCachedRoutable
+
+- (instancetype)initWithRoutable:(id<AUTRoutable>)routable expirationTime:(NSTimeInterval)expirationTime {
+    self = [super init];
+
+    _routable = routable;
+    _expirationTime = expirationTime;
+
+    return self;
+}
+
+@end
+
+@implementation AUTRouteCounters {
+    /// Incremented with relaxed ordering, as they are only ever read as a
+    /// snapshot.
+    _Atomic(uint64_t) _hitCount;
+    _Atomic(uint64_t) _nearMissCount;
+    _Atomic(uint64_t) _handlerNanoseconds;
+}
+
+- (uint64_t)hitCount {
+    return atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (uint64_t)nearMissCount {
+    return atomic_load_explicit(&_nearMissCount, memory_order_relaxed);
+}
+
+- (NSTimeInterval)handlerDuration {
+    return atomic_load_explicit(&_handlerNanoseconds, memory_order_relaxed) / (NSTimeInterval)NSEC_PER_SEC;
+}
 
-@implementation AUTRoute
+- (void)recordHit {
+    atomic_fetch_add_explicit(&_hitCount, 1, memory_order_relaxed);
+}
+
+- (void)recordNearMiss {
+    atomic_fetch_add_explicit(&_nearMissCount, 1, memory_order_relaxed);
+}
+
+- (void)recordHandlerDuration:(NSTimeInterval)duration {
+    atomic_fetch_add_explicit(&_handlerNanoseconds, (uint64_t)(MAX(duration, 0) * NSEC_PER_SEC), memory_order_relaxed);
+}
+
+- (void)reset {
+    atomic_store_explicit(&_hitCount, 0, memory_order_relaxed);
+    atomic_store_explicit(&_nearMissCount, 0, memory_order_relaxed);
+    atomic_store_explicit(&_handlerNanoseconds, 0, memory_order_relaxed);
+}
+
+@end
+
+@implementation AUTRoute {
+    /// The interned identifier of each of the receiver's components, with
+    /// dynamic components represented by AUTRouteSegmentIDDynamic.
+    ///
+    /// Has the same number of elements as the receiver's components.
+    AUTRouteSegmentID *_segmentIDs;
+
+    /// The number of path components at the start of the receiver's
+    /// components, which precede any query keys.
+    NSUInteger _pathComponentCount;
+
+    /// The number of the receiver's path components that are not dynamic.
+    NSUInteger _staticComponentCount;
+
+    /// The query keys that the receiver declares, or nil if none.
+    NSArray<NSString *> * _Nullable _requiredQueryKeys;
+    NSArray<NSString *> * _Nullable _optionalQueryKeys;
+
+    /// The next routables sent by the handler of an idempotent receiver, keyed
+    /// by the parameters that they were sent for. Guarded by self.
+    NSMutableDictionary<NSDictionary<NSString *, NSString *> *, AUTRouteCachedRoutable *> *_cachedRoutables;
+
+    /// The handlers of a receiver that requires a context object, keyed by the
+    /// context class that they handle, or nil if the receiver does not require
+    /// a context object. Guarded by self.
+    NSMutableDictionary<Class, AUTRouteWithContextHandlerBlock> * _Nullable _contextHandlers;
+
+    /// The handler resolved for each concrete context class that has been
+    /// routed with, or NSNull if no handler fits. Guarded by self.
+    NSMutableDictionary<Class, id> * _Nullable _contextHandlerCache;
+
+    /// The lazily compiled URL template of the receiver. Guarded by self.
+    AUTRouteTemplate * _Nullable _URLTemplate;
+}
 
 #pragma mark - Lifecycle
 
@@ -27,12 +152,55 @@ static let DynamicPrefix = @":";
 
     self = [super init];
 
-    _components = [components copy];
+    _counters = [[AUTRouteCounters alloc] init];
+    _staticRouteIndex = NSNotFound;
+
+    let internedComponents = [NSMutableArray<NSString *> arrayWithCapacity:components.count];
+    _segmentIDs = malloc(MAX(components.count, 1) * sizeof(AUTRouteSegmentID));
+
+    let requiredQueryKeys = [NSMutableArray<NSString *> array];
+    let optionalQueryKeys = [NSMutableArray<NSString *> array];
+
+    for (NSUInteger index = 0; index < components.count; index++) {
+        BOOL isOptional = NO;
+        let queryKey = QueryKey(components[index], &isOptional);
+
+        if (queryKey != nil) {
+            [(isOptional ? optionalQueryKeys : requiredQueryKeys) addObject:AUTNotNil(queryKey)];
+            [internedComponents addObject:components[index]];
+            _segmentIDs[index] = AUTRouteSegmentIDNotFound;
+            continue;
+        }
+
+        NSAssert(requiredQueryKeys.count == 0 && optionalQueryKeys.count == 0, @"Query keys must follow all path components");
+        _pathComponentCount++;
+
+        NSString *internedComponent;
+        let segmentID = AUTRouteSegmentIntern(components[index], &internedComponent);
+
+        [internedComponents addObject:internedComponent];
+        _segmentIDs[index] = [internedComponent hasPrefix:DynamicPrefix] ? AUTRouteSegmentIDDynamic : segmentID;
+
+        if (_segmentIDs[index] != AUTRouteSegmentIDDynamic) {
+            _staticComponentCount++;
+        }
+    }
+
+    NSAssert(_pathComponentCount > 0, @"Routes must have at least one path component");
+
+    _components = [internedComponents copy];
+    _identifier = [_components componentsJoinedByString:@"/"];
+    _requiredQueryKeys = (requiredQueryKeys.count > 0) ? [requiredQueryKeys copy] : nil;
+    _optionalQueryKeys = (optionalQueryKeys.count > 0) ? [optionalQueryKeys copy] : nil;
     _handler = [handler copy];
 
     return self;
 }
 
+- (void)dealloc {
+    free(_segmentIDs);
+}
+
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components signal:(RACSignal<id<AUTRoutable>> *)signal {
     AUTAssertNotNil(components, signal);
 
@@ -43,6 +211,47 @@ static let DynamicPrefix = @":";
         }];
 }
 
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components command:(RACCommand *)command input:(nullable id)input {
+    AUTAssertNotNil(components, command);
+
+    @weakify(command);
+
+    // A single subscription in place of deferring, taking and filtering the
+    // execution signal and then combining it with the remaining components.
+    return [self
+        initWithComponents:components
+        routeHandler:^(NSDictionary<NSString *, NSString *> *_1, id _Nullable _2, NSArray<NSString *> *remainingComponents, NSURL *_3) {
+            return [RACSignal createSignal:^ RACDisposable * _Nullable (id<RACSubscriber> subscriber) {
+                @strongify(command);
+                if (command == nil) {
+                    [subscriber sendCompleted];
+                    return nil;
+                }
+
+                let disposable = [RACSerialDisposable serialDisposable];
+
+                disposable.disposable = [[command execute:input]
+                    subscribeNext:^(id routable) {
+                        [disposable dispose];
+
+                        if (AUTIsRoutable(routable)) {
+                            [subscriber sendNext:RACTuplePack(routable, remainingComponents)];
+                        }
+
+                        [subscriber sendCompleted];
+                    }
+                    error:^(NSError *error) {
+                        [subscriber sendError:error];
+                    }
+                    completed:^{
+                        [subscriber sendCompleted];
+                    }];
+
+                return disposable;
+            }];
+        }];
+}
+
 static let SingleTokenKey = @"single-token";
 
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components singleTokenHandler:(AUTRouteWithSingleTokenHandlerBlock)handler {
@@ -50,8 +259,19 @@ static let SingleTokenKey = @"single-token";
     
     AUTRouteWithSingleTokenHandlerBlock copiedHandler = [handler copy];
     
+    // The token follows the path components, ahead of any query keys.
+    var tokenIndex = components.count;
+    for (NSUInteger index = 0; index < components.count; index++) {
+        BOOL isOptional = NO;
+        if (QueryKey(components[index], &isOptional) != nil) {
+            tokenIndex = index;
+            break;
+        }
+    }
+
     let tokenPattern = [DynamicPrefix stringByAppendingString:SingleTokenKey];
-    let componentsWithToken = [components arrayByAddingObject:tokenPattern];
+    let componentsWithToken = [components mutableCopy];
+    [componentsWithToken insertObject:tokenPattern atIndex:tokenIndex];
 
     return [self
         initWithComponents:componentsWithToken
@@ -66,6 +286,24 @@ static let SingleTokenKey = @"single-token";
         }];
 }
 
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components staticHandler:(AUTStaticRouteHandler)staticHandler table:(AUTStaticRouteTable *)table index:(NSUInteger)index {
+    AUTAssertNotNil(components, table);
+    NSParameterAssert(staticHandler != NULL);
+
+    self = [self
+        initWithComponents:components
+        routeHandler:^(NSDictionary<NSString *, NSString *> *parameters, id _Nullable context, NSArray<NSString *> *remainingComponents, NSURL *url) {
+            let routables = staticHandler(nil, parameters, context, url);
+            return [routables combineLatestWith:[RACSignal return:remainingComponents]];
+        }];
+
+    _staticHandler = staticHandler;
+    _staticRouteTable = table;
+    _staticRouteIndex = index;
+
+    return self;
+}
+
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components handler:(AUTRouteWithoutContextHandlerBlock)handler {
     AUTAssertNotNil(components, handler);
     
@@ -81,16 +319,25 @@ static let SingleTokenKey = @"single-token";
 
 - (instancetype)initWithComponents:(NSArray<NSString *> *)components contextClass:(Class)contextClass handler:(AUTRouteWithContextHandlerBlock)handler {
     AUTAssertNotNil(components, contextClass, handler);
-    
-    AUTRouteWithContextHandlerBlock copiedHandler = [handler copy];
 
     @weakify(self);
     
-    return [self
+    self = [self
         initWithComponents:components
         routeHandler:^ RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * (NSDictionary<NSString *, NSString *> *parameters, id _Nullable context, NSArray<NSString *> *remainingComponents, NSURL *url){
-            if (context == nil || ![context isKindOfClass:contextClass]) {
-                let description = [NSString stringWithFormat:@"%@ matched a pattern and expected context object %@ to be a kind of class %@.", self_weak_, context, NSStringFromClass(contextClass)];
+            @strongifyOr(self) return [RACSignal empty];
+
+            var contextHandler = (context != nil) ? [self contextHandlerForClass:[context class]] : nil;
+
+            // Restoration is handled with the context that it wraps, unless
+            // there is a handler for restoration itself.
+            if (contextHandler == nil && [context isKindOfClass:AUTRoutingRestorationContext.class]) {
+                context = ((AUTRoutingRestorationContext *)context).context;
+                contextHandler = (context != nil) ? [self contextHandlerForClass:[context class]] : nil;
+            }
+
+            if (contextHandler == nil) {
+                let description = [NSString stringWithFormat:@"%@ matched a pattern and expected context object %@ to be a kind of class %@.", self, context, self.contextClassesDescription];
 
                 let userInfo = (NSMutableDictionary<NSString *, id> *)[NSMutableDictionary dictionaryWithDictionary:@{
                    NSLocalizedDescriptionKey: description,
@@ -106,10 +353,14 @@ static let SingleTokenKey = @"single-token";
                 return [RACSignal error:error];
             }
             
-            let routables = copiedHandler(parameters, AUTNotNil(context), url);
+            let routables = contextHandler(parameters, AUTNotNil(context), url);
             
             return [routables combineLatestWith:[RACSignal return:remainingComponents]];
         }];
+
+    _contextHandlers = [NSMutableDictionary dictionaryWithObject:[handler copy] forKey:(id<NSCopying>)contextClass];
+
+    return self;
 }
 
 #pragma mark - AUTRoute
@@ -118,26 +369,109 @@ static let SingleTokenKey = @"single-token";
     AUTAssertNotNil(components);
     NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
 
-    NSInteger matchLength = 0;
+    let count = components.count;
+    AUTRouteSegmentID stackSegmentIDs[AUTRouteSegmentStackBufferCount];
+    AUTRouteSegmentID *segmentIDs = (count <= AUTRouteSegmentStackBufferCount) ? stackSegmentIDs : malloc(count * sizeof(AUTRouteSegmentID));
+    AUTRouteSegmentLookup(components, segmentIDs);
+
+    let matchingCount = [self matchingCountWithSegmentIDs:segmentIDs count:count];
+
+    if (segmentIDs != stackSegmentIDs) free(segmentIDs);
+
+    return matchingCount;
+}
+
+- (nullable NSURL *)URLWithScheme:(NSString *)scheme parameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(scheme, parameters);
+
+    return [AUTRouteTemplate URLWithScheme:scheme templates:@[ self.URLTemplate ] parameters:parameters];
+}
+
++ (nullable NSURL *)URLWithScheme:(NSString *)scheme routes:(NSArray<AUTRoute *> *)routes parameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(scheme, routes, parameters);
+    NSAssert(routes.count > 0, @"Unable to generate a URL from zero routes, this is programmer error");
+
+    let templates = [NSMutableArray<AUTRouteTemplate *> arrayWithCapacity:routes.count];
+    for (AUTRoute *route in routes) {
+        [templates addObject:route.URLTemplate];
+    }
+
+    return [AUTRouteTemplate URLWithScheme:scheme templates:templates parameters:parameters];
+}
+
+- (NSUInteger)pathComponentCount {
+    return _pathComponentCount;
+}
+
+- (NSUInteger)staticComponentCount {
+    return _staticComponentCount;
+}
+
+- (AUTRouteSegmentID)firstSegmentID {
+    return _segmentIDs[0];
+}
+
+- (NSArray<Class> *)contextClasses {
+    @synchronized (self) {
+        if (_contextHandlers == nil) return @[];
+
+        return [_contextHandlers.allKeys sortedArrayUsingComparator:^(Class class1, Class class2) {
+            return [NSStringFromClass(class1) compare:NSStringFromClass(class2)];
+        }];
+    }
+}
+
+- (nullable NSArray<NSString *> *)requiredQueryKeys {
+    return _requiredQueryKeys;
+}
+
+- (nullable NSArray<NSString *> *)optionalQueryKeys {
+    return _optionalQueryKeys;
+}
+
+- (AUTRouteTemplate *)URLTemplate {
+    @synchronized (self) {
+        if (_URLTemplate == nil) {
+            _URLTemplate = [[AUTRouteTemplate alloc] initWithRoute:self];
+        }
+
+        return AUTNotNil(_URLTemplate);
+    }
+}
+
+- (BOOL)hasQueryKeys {
+    return _requiredQueryKeys != nil || _optionalQueryKeys != nil;
+}
+
+- (BOOL)matchesQueryParameters:(NSDictionary<NSString *, NSString *> *)queryParameters {
+    AUTAssertNotNil(queryParameters);
+
+    for (NSString *key in _requiredQueryKeys) {
+        if (queryParameters[key] == nil) return NO;
+    }
+
+    return YES;
+}
+
+- (NSInteger)matchingCountWithSegmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count {
+    NSParameterAssert(segmentIDs != NULL);
+    NSAssert(count > 0, @"Unable to handle zero components, this is programmer error");
+
+    let patternCount = _pathComponentCount;
 
     // No match if there's more components than input components
-    if (self.components.count > components.count) return 0;
+    if (patternCount > count) return 0;
 
-    for (NSUInteger index = 0; index < components.count; index++) {
-        if (index == self.components.count) return self.components.count;
+    NSInteger matchLength = 0;
 
-        let patternComponent = self.components[index];
-        let component = components[index];
+    for (NSUInteger index = 0; index < patternCount; index++) {
+        let patternSegmentID = _segmentIDs[index];
 
-        if ([patternComponent isEqualToString:component]) {
-            matchLength++;
-            continue;
-        } else if ([patternComponent hasPrefix:DynamicPrefix]) {
-            matchLength++;
-            continue;
-        } else {
+        if (patternSegmentID != AUTRouteSegmentIDDynamic && patternSegmentID != segmentIDs[index]) {
             return matchLength;
         }
+
+        matchLength++;
     }
 
     return matchLength;
@@ -148,21 +482,134 @@ static let SingleTokenKey = @"single-token";
     NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
 
     let matchLength = [self matchingCountWithComponents:components];
+    let queryParameters = self.hasQueryKeys ? url.aut_queryParameters : nil;
+
+    let parameters = [self parametersForComponents:components matchLength:matchLength queryParameters:queryParameters];
+    let remainingComponents = [components subarrayWithRange:NSMakeRange(matchLength, components.count - matchLength)];
+
+    return [self handleParameters:parameters remainingComponents:remainingComponents context:context URL:url target:nil];
+}
+
+- (NSDictionary<NSString *, NSString *> *)parametersForComponents:(NSArray<NSString *> *)components matchLength:(NSInteger)matchLength queryParameters:(nullable NSDictionary<NSString *, NSString *> *)queryParameters {
+    AUTAssertNotNil(components);
+    NSAssert(matchLength >= 0 && matchLength <= (NSInteger)components.count, @"Match length must not exceed the component count, this is programmer error");
 
     NSMutableDictionary<NSString *, NSString *> *parameters = [NSMutableDictionary dictionary];
 
     for (NSInteger index = 0; index < matchLength; index++) {
-        let pattern = self.components[index];
-
-        if ([pattern hasPrefix:DynamicPrefix]) {
-            let key = [pattern substringFromIndex:1];
+        if (_segmentIDs[index] == AUTRouteSegmentIDDynamic) {
+            let key = [self.components[index] substringFromIndex:DynamicPrefix.length];
             parameters[key] = components[index];
         }
     }
 
-    let remainingComponents = [components.rac_sequence skip:matchLength].array;
+    for (NSString *key in _requiredQueryKeys) {
+        parameters[key] = queryParameters[key];
+    }
+
+    for (NSString *key in _optionalQueryKeys) {
+        parameters[key] = queryParameters[key];
+    }
 
-    return self.handler(parameters, context, remainingComponents, url);
+    return [parameters copy];
+}
+
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleParameters:(NSDictionary<NSString *, NSString *> *)parameters remainingComponents:(NSArray<NSString *> *)remainingComponents context:(nullable id)context URL:(NSURL *)url target:(nullable id)target {
+    AUTAssertNotNil(parameters, remainingComponents, url);
+
+    if (self.fansOut) {
+        let handling = (self.staticHandler != NULL)
+            ? [self.staticHandler(target, parameters, context, url) combineLatestWith:[RACSignal return:remainingComponents]]
+            : self.handler(parameters, context, remainingComponents, url);
+
+        // Branches replace the remaining components with their own slice.
+        return [handling map:^(RACTwoTuple<id, NSArray<NSString *> *> *routableAndRemainingComponents) {
+            let branch = (AUTRoutingBranch *)routableAndRemainingComponents.first;
+            if (![branch isKindOfClass:AUTRoutingBranch.class]) return routableAndRemainingComponents;
+
+            return (RACTwoTuple<id, NSArray<NSString *> *> *)RACTuplePack(branch.routable, branch.components);
+        }];
+    }
+
+    // Static routes are shared between targets, so their next routables are
+    // never cached.
+    if (self.staticHandler != NULL) {
+        let routables = self.staticHandler(target, parameters, context, url);
+        return [routables combineLatestWith:[RACSignal return:remainingComponents]];
+    }
+
+    if (!self.idempotent) return self.handler(parameters, context, remainingComponents, url);
+
+    let cachedRoutable = [self cachedRoutableForParameters:parameters];
+    if (cachedRoutable != nil) {
+        return [RACSignal return:RACTuplePack(cachedRoutable, remainingComponents)];
+    }
+
+    @weakify(self);
+
+    return [self.handler(parameters, context, remainingComponents, url)
+        doNext:^(RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *routableAndRemainingComponents) {
+            @strongifyOr(self) return;
+
+            [self cacheRoutable:routableAndRemainingComponents.first forParameters:parameters];
+        }];
+}
+
+- (BOOL)addHandler:(AUTRouteWithContextHandlerBlock)handler forContextClass:(Class)contextClass {
+    AUTAssertNotNil(handler, contextClass);
+
+    @synchronized (self) {
+        if (_contextHandlers == nil || _contextHandlers[(id<NSCopying>)contextClass] != nil) return NO;
+
+        _contextHandlers[(id<NSCopying>)contextClass] = [handler copy];
+
+        // Resolutions may now be shadowed by the new handler.
+        _contextHandlerCache = nil;
+    }
+
+    return YES;
+}
+
+- (void)removeCachedRoutables {
+    @synchronized (self) {
+        _cachedRoutables = nil;
+    }
+}
+
+- (NSUInteger)segmentByteCount {
+    var byteCount = malloc_size(_segmentIDs) + self.components.count * sizeof(id);
+
+    for (NSString *component in self.components) {
+        byteCount += [component lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return byteCount;
+}
+
+- (NSUInteger)cacheByteCount {
+    @synchronized (self) {
+        var byteCount = _contextHandlerCache.count * 2 * sizeof(id) + _URLTemplate.byteCount;
+
+        let cachedRoutableSize = class_getInstanceSize(AUTRouteCachedRoutable.class) + 2 * sizeof(id);
+
+        for (NSDictionary<NSString *, NSString *> *parameters in _cachedRoutables) {
+            byteCount += cachedRoutableSize;
+
+            for (NSString *key in parameters) {
+                byteCount += 2 * sizeof(id) + [key lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + [parameters[key] lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+            }
+        }
+
+        return byteCount;
+    }
+}
+
+- (void)purgeCaches {
+    @synchronized (self) {
+        _cachedRoutables = nil;
+        _contextHandlerCache = nil;
+        _URLTemplate = nil;
+    }
 }
 
 #pragma mark - NSObject
@@ -177,6 +624,81 @@ static let SingleTokenKey = @"single-token";
     return self.components.hash;
 }
 
+#pragma mark - Private
+
+/// Returns the handler registered for the closest ancestor of the provided
+/// class, or nil if there is none.
+///
+/// The superclasses of each class are walked once, after which the resolved
+/// handler is cached.
+- (nullable AUTRouteWithContextHandlerBlock)contextHandlerForClass:(Class)contextClass {
+    AUTAssertNotNil(contextClass);
+
+    @synchronized (self) {
+        id cachedHandler = _contextHandlerCache[(id<NSCopying>)contextClass];
+        if (cachedHandler != nil) return (cachedHandler != NSNull.null) ? cachedHandler : nil;
+
+        AUTRouteWithContextHandlerBlock handler;
+        for (Class class = contextClass; class != Nil && handler == nil; class = class_getSuperclass(class)) {
+            handler = _contextHandlers[(id<NSCopying>)class];
+        }
+
+        if (_contextHandlerCache == nil) {
+            _contextHandlerCache = [NSMutableDictionary dictionary];
+        }
+
+        _contextHandlerCache[(id<NSCopying>)contextClass] = handler ?: NSNull.null;
+
+        return handler;
+    }
+}
+
+- (NSString *)contextClassesDescription {
+    let classNames = [NSMutableArray<NSString *> arrayWithCapacity:self.contextClasses.count];
+    for (Class class in self.contextClasses) {
+        [classNames addObject:NSStringFromClass(class)];
+    }
+
+    return [classNames componentsJoinedByString:@" or "];
+}
+
+- (nullable id<AUTRoutable>)cachedRoutableForParameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(parameters);
+
+    @synchronized (self) {
+        let cachedRoutable = _cachedRoutables[parameters];
+        if (cachedRoutable == nil) return nil;
+
+        let routable = cachedRoutable.routable;
+        let expirationTime = cachedRoutable.expirationTime;
+
+        if (routable == nil || (expirationTime > 0 && AUTRoutingMonotonicTime() >= expirationTime)) {
+            [_cachedRoutables removeObjectForKey:parameters];
+            return nil;
+        }
+
+        return routable;
+    }
+}
+
+- (void)cacheRoutable:(nullable id<AUTRoutable>)routable forParameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(parameters);
+
+    if (routable == nil) return;
+
+    let lifetime = self.cachedRoutableLifetime;
+    let expirationTime = (lifetime > 0) ? AUTRoutingMonotonicTime() + lifetime : 0;
+    let cachedRoutable = [[AUTRouteCachedRoutable alloc] initWithRoutable:AUTNotNil(routable) expirationTime:expirationTime];
+
+    @synchronized (self) {
+        if (_cachedRoutables == nil) {
+            _cachedRoutables = [NSMutableDictionary dictionary];
+        }
+
+        _cachedRoutables[[parameters copy]] = cachedRoutable;
+    }
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
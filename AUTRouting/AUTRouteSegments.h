@@ -0,0 +1,61 @@
+//
+//  AUTRouteSegments.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Identifies a route segment string that has been interned in the global
+/// segment table.
+///
+/// Two segments have the same identifier if and only if their strings are
+/// equal, so segments can be compared with integer equality.
+typedef uint32_t AUTRouteSegmentID;
+
+/// The identifier of a segment that has never been interned.
+///
+/// No interned segment is ever assigned this identifier, so it never compares
+/// equal to a static pattern segment.
+static const AUTRouteSegmentID AUTRouteSegmentIDNotFound = 0;
+
+/// Never assigned to an interned segment. Used by route patterns in place of
+/// the identifier of a dynamic token segment, which matches any segment.
+static const AUTRouteSegmentID AUTRouteSegmentIDDynamic = UINT32_MAX;
+
+/// The number of segment identifiers that callers of AUTRouteSegmentLookup
+/// should reserve on the stack, above which a heap buffer should be used
+/// instead, as the number of components in a URL is unbounded.
+static const NSUInteger AUTRouteSegmentStackBufferCount = 32;
+
+/// Interns the provided segment, assigning it an identifier if it does not
+/// already have one.
+///
+/// Interned segments are never removed, so this should only be called with
+/// route pattern segments rather than arbitrary URL segments.
+///
+/// @param segment The segment to intern.
+///
+/// @param internedSegment If non-NULL, populated with the table's canonical
+///        instance of the segment, which can be used in place of the provided
+///        one to share storage between routes.
+///
+/// @return The identifier of the provided segment.
+FOUNDATION_EXTERN AUTRouteSegmentID AUTRouteSegmentIntern(NSString *segment, NSString * _Nullable __autoreleasing * _Nullable internedSegment);
+
+/// Populates the provided buffer with the identifiers of each of the given
+/// segments, without interning them.
+///
+/// Segments that have never been interned are assigned
+/// AUTRouteSegmentIDNotFound.
+///
+/// @param segments The segments to look up.
+///
+/// @param segmentIDs A buffer with room for at least as many identifiers as
+///        there are segments.
+FOUNDATION_EXTERN void AUTRouteSegmentLookup(NSArray<NSString *> *segments, AUTRouteSegmentID *segmentIDs);
+
+NS_ASSUME_NONNULL_END
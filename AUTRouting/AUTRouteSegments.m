@@ -0,0 +1,80 @@
+//
+//  AUTRouteSegments.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <pthread.h>
+
+#import "AUTExtObjC.h"
+
+#import "AUTRouteSegments.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Guards SegmentIDs and Segments.
+///
+/// Lookups vastly outnumber insertions, so readers are allowed to proceed
+/// concurrently.
+static pthread_rwlock_t SegmentsLock = PTHREAD_RWLOCK_INITIALIZER;
+
+/// Maps each interned segment string to its identifier.
+static NSMutableDictionary<NSString *, NSNumber *> *SegmentIDs;
+
+/// The canonical instance of each interned segment string, where the segment
+/// with an identifier of N is at index N - 1.
+static NSMutableArray<NSString *> *Segments;
+
+AUTRouteSegmentID AUTRouteSegmentIntern(NSString *segment, NSString * _Nullable __autoreleasing * _Nullable internedSegment) {
+    AUTCAssertNotNil(segment);
+
+    pthread_rwlock_wrlock(&SegmentsLock);
+
+    if (SegmentIDs == nil) {
+        SegmentIDs = [NSMutableDictionary dictionary];
+        Segments = [NSMutableArray array];
+    }
+
+    NSString *canonicalSegment;
+    AUTRouteSegmentID segmentID;
+
+    NSNumber * _Nullable existingID = SegmentIDs[segment];
+    if (existingID != nil) {
+        segmentID = existingID.unsignedIntValue;
+        canonicalSegment = Segments[segmentID - 1];
+    } else {
+        NSCAssert(Segments.count < AUTRouteSegmentIDDynamic - 1, @"Exhausted route segment identifiers");
+
+        canonicalSegment = [segment copy];
+        [Segments addObject:canonicalSegment];
+
+        segmentID = (AUTRouteSegmentID)Segments.count;
+        SegmentIDs[canonicalSegment] = @(segmentID);
+    }
+
+    pthread_rwlock_unlock(&SegmentsLock);
+
+    if (internedSegment != NULL) {
+        *internedSegment = canonicalSegment;
+    }
+
+    return segmentID;
+}
+
+void AUTRouteSegmentLookup(NSArray<NSString *> *segments, AUTRouteSegmentID *segmentIDs) {
+    AUTCAssertNotNil(segments);
+    NSCParameterAssert(segmentIDs != NULL);
+
+    pthread_rwlock_rdlock(&SegmentsLock);
+
+    NSUInteger index = 0;
+    for (NSString *segment in segments) {
+        NSNumber * _Nullable segmentID = SegmentIDs[segment];
+        segmentIDs[index++] = (segmentID != nil) ? segmentID.unsignedIntValue : AUTRouteSegmentIDNotFound;
+    }
+
+    pthread_rwlock_unlock(&SegmentsLock);
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,47 @@
+//
+//  AUTRouteStatistics.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A snapshot of the usage counters of a single route.
+///
+/// @see -[AUTRoutes routeStatistics]
+@interface AUTRouteStatistics : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRouteIdentifier:(NSString *)routeIdentifier hitCount:(uint64_t)hitCount nearMissCount:(uint64_t)nearMissCount handlerDuration:(NSTimeInterval)handlerDuration NS_DESIGNATED_INITIALIZER;
+
+/// The identifier of the route that the counters are for.
+///
+/// @see AUTRoute.identifier
+@property (readonly, nonatomic, copy) NSString *routeIdentifier;
+
+/// The number of times that the route was selected to handle components.
+@property (readonly, nonatomic) uint64_t hitCount;
+
+/// The number of times that the route matched some but not all of its path
+/// components, or all of its path components but not its required query keys.
+///
+/// Routes with near misses but no hits often indicate URLs that are generated
+/// with the wrong components.
+@property (readonly, nonatomic) uint64_t nearMissCount;
+
+/// The cumulative time between the route's handler being invoked and its
+/// signal terminating or routing being cancelled.
+@property (readonly, nonatomic) NSTimeInterval handlerDuration;
+
+/// A representation of the receiver that can be serialized with
+/// NSJSONSerialization, with the keys "route", "hits", "near_misses" and
+/// "handler_duration".
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, id> *JSONObject;
+
+@end
+
+NS_ASSUME_NONNULL_END
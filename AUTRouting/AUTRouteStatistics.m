@@ -0,0 +1,52 @@
+//
+//  AUTRouteStatistics.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRouteStatistics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTRouteStatistics
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRouteIdentifier:(NSString *)routeIdentifier hitCount:(uint64_t)hitCount nearMissCount:(uint64_t)nearMissCount handlerDuration:(NSTimeInterval)handlerDuration {
+    AUTAssertNotNil(routeIdentifier);
+
+    self = [super init];
+
+    _routeIdentifier = [routeIdentifier copy];
+    _hitCount = hitCount;
+    _nearMissCount = nearMissCount;
+    _handlerDuration = handlerDuration;
+
+    return self;
+}
+
+#pragma mark - AUTRouteStatistics
+
+- (NSDictionary<NSString *, id> *)JSONObject {
+    return @{
+        @"route": self.routeIdentifier,
+        @"hits": @(self.hitCount),
+        @"near_misses": @(self.nearMissCount),
+        @"handler_duration": @(self.handlerDuration),
+    };
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> %@ hits: %llu, near misses: %llu, handler duration: %.3fs", self.class, self, self.routeIdentifier, self.hitCount, self.nearMissCount, self.handlerDuration];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
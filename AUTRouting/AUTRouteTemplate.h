@@ -0,0 +1,39 @@
+//
+//  AUTRouteTemplate.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+@class AUTRoute;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A route's pattern compiled for generating URLs, with its static components
+/// percent-encoded up front so that generating a URL only encodes parameter
+/// values.
+@interface AUTRouteTemplate : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRoute:(AUTRoute *)route NS_DESIGNATED_INITIALIZER;
+
+/// An estimate of the number of bytes used by the receiver.
+@property (readonly, nonatomic) NSUInteger byteCount;
+
+/// Generates a URL with the provided scheme whose routing components are those
+/// of each of the templates in order, with dynamic components and query keys
+/// populated from the provided parameters.
+///
+/// The URL is encoded in a single pass into a buffer that is allocated once at
+/// its maximum possible length.
+///
+/// @return The URL, or nil if a dynamic component or required query key has no
+///         value in the parameters, or a dynamic component's value is empty.
++ (nullable NSURL *)URLWithScheme:(NSString *)scheme templates:(NSArray<AUTRouteTemplate *> *)templates parameters:(NSDictionary<NSString *, NSString *> *)parameters;
+
+@end
+
+NS_ASSUME_NONNULL_END
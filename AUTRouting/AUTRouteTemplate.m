@@ -0,0 +1,222 @@
+//
+//  AUTRouteTemplate.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import ObjectiveC.runtime;
+
+#import "AUTExtObjC.h"
+#import "AUTRoute_Private.h"
+
+#import "AUTRouteTemplate.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static let DynamicPrefix = @":";
+
+/// The size of the stack buffers that URLs and path segments are encoded into,
+/// above which a heap buffer is used instead.
+static const NSUInteger StackBufferSize = 1024;
+
+/// The characters that may appear unencoded in path components. Excludes ";",
+/// which begins path parameters, so that every component round-trips through
+/// tokenizing.
+static const char *PathCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~!$&'()*+,=:@";
+
+/// The characters that may appear unencoded in query keys and values.
+static const char *QueryCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~!$'()*,:@/?";
+
+static const uint8_t PathCharacterMask = 1 << 0;
+static const uint8_t QueryCharacterMask = 1 << 1;
+
+/// The masks of the character sets that each byte belongs to.
+static uint8_t CharacterMasks[256];
+
+static const char HexDigits[] = "0123456789ABCDEF";
+
+/// Percent-encodes the UTF-8 bytes of the provided string into the buffer,
+/// which must have room for three times as many bytes.
+///
+/// @return The number of bytes written.
+static NSUInteger EncodeString(NSString *string, uint8_t mask, uint8_t *buffer) {
+    let utf8 = (const uint8_t *)string.UTF8String;
+    NSUInteger length = 0;
+
+    for (const uint8_t *byte = utf8; *byte != '\0'; byte++) {
+        if ((CharacterMasks[*byte] & mask) != 0) {
+            buffer[length++] = *byte;
+        } else {
+            buffer[length++] = '%';
+            buffer[length++] = (uint8_t)HexDigits[*byte >> 4];
+            buffer[length++] = (uint8_t)HexDigits[*byte & 0xF];
+        }
+    }
+
+    return length;
+}
+
+@implementation AUTRouteTemplate {
+    /// The path segments of the template in order, each either the encoded
+    /// bytes of a static component including its leading "/" as NSData, or
+    /// the parameter key of a dynamic component as an NSString.
+    NSArray *_pathSegments;
+
+    /// The total length of the static path segments.
+    NSUInteger _staticPathLength;
+
+    NSArray<NSString *> *_requiredQueryKeys;
+    NSArray<NSString *> *_optionalQueryKeys;
+}
+
++ (void)initialize {
+    if (self != AUTRouteTemplate.class) return;
+
+    for (const char *character = PathCharacters; *character != '\0'; character++) {
+        CharacterMasks[(uint8_t)*character] |= PathCharacterMask;
+    }
+
+    for (const char *character = QueryCharacters; *character != '\0'; character++) {
+        CharacterMasks[(uint8_t)*character] |= QueryCharacterMask;
+    }
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRoute:(AUTRoute *)route {
+    AUTAssertNotNil(route);
+
+    self = [super init];
+
+    let components = route.components;
+    let pathSegments = [NSMutableArray arrayWithCapacity:route.pathComponentCount];
+
+    for (NSUInteger index = 0; index < route.pathComponentCount; index++) {
+        let component = components[index];
+
+        if ([component hasPrefix:DynamicPrefix]) {
+            [pathSegments addObject:[component substringFromIndex:DynamicPrefix.length]];
+            continue;
+        }
+
+        let maximumLength = [component lengthOfBytesUsingEncoding:NSUTF8StringEncoding] * 3 + 1;
+
+        uint8_t stackBuffer[StackBufferSize];
+        uint8_t *buffer = (maximumLength <= StackBufferSize) ? stackBuffer : malloc(maximumLength);
+
+        buffer[0] = '/';
+        let length = 1 + EncodeString(component, PathCharacterMask, buffer + 1);
+
+        [pathSegments addObject:[NSData dataWithBytes:buffer length:length]];
+        _staticPathLength += length;
+
+        if (buffer != stackBuffer) free(buffer);
+    }
+
+    _pathSegments = [pathSegments copy];
+    _requiredQueryKeys = route.requiredQueryKeys ?: @[];
+    _optionalQueryKeys = route.optionalQueryKeys ?: @[];
+
+    return self;
+}
+
+#pragma mark - AUTRouteTemplate
+
+- (NSUInteger)byteCount {
+    var byteCount = class_getInstanceSize(self.class) + _pathSegments.count * sizeof(id);
+
+    for (id segment in _pathSegments) {
+        byteCount += [segment isKindOfClass:NSData.class] ? ((NSData *)segment).length : [segment lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return byteCount;
+}
+
++ (nullable NSURL *)URLWithScheme:(NSString *)scheme templates:(NSArray<AUTRouteTemplate *> *)templates parameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(scheme, templates, parameters);
+
+    // Measure the maximum length of the URL, assuming every byte of every
+    // value is encoded, so that it can be encoded in a single pass.
+    var maximumLength = [scheme lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + 1;
+
+    for (AUTRouteTemplate *template in templates) {
+        maximumLength += template->_staticPathLength;
+
+        for (id segment in template->_pathSegments) {
+            if (![segment isKindOfClass:NSString.class]) continue;
+
+            let value = parameters[segment];
+            if (value.length == 0) return nil;
+
+            maximumLength += 1 + [value lengthOfBytesUsingEncoding:NSUTF8StringEncoding] * 3;
+        }
+
+        for (NSString *key in template->_requiredQueryKeys) {
+            if (parameters[key] == nil) return nil;
+        }
+
+        for (NSArray<NSString *> *keys in @[ template->_requiredQueryKeys, template->_optionalQueryKeys ]) {
+            for (NSString *key in keys) {
+                let value = parameters[key];
+                if (value == nil) continue;
+
+                maximumLength += 2 + ([key lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + [value lengthOfBytesUsingEncoding:NSUTF8StringEncoding]) * 3;
+            }
+        }
+    }
+
+    uint8_t stackBuffer[StackBufferSize];
+    uint8_t *buffer = (maximumLength <= StackBufferSize) ? stackBuffer : malloc(maximumLength);
+    NSUInteger length = 0;
+
+    let schemeLength = [scheme lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    memcpy(buffer, scheme.UTF8String, schemeLength);
+    length += schemeLength;
+    buffer[length++] = ':';
+
+    for (AUTRouteTemplate *template in templates) {
+        for (id segment in template->_pathSegments) {
+            if ([segment isKindOfClass:NSData.class]) {
+                let data = (NSData *)segment;
+                memcpy(buffer + length, data.bytes, data.length);
+                length += data.length;
+            } else {
+                buffer[length++] = '/';
+                length += EncodeString(AUTNotNil(parameters[segment]), PathCharacterMask, buffer + length);
+            }
+        }
+    }
+
+    var querySeparator = (uint8_t)'?';
+
+    for (AUTRouteTemplate *template in templates) {
+        for (NSArray<NSString *> *keys in @[ template->_requiredQueryKeys, template->_optionalQueryKeys ]) {
+            for (NSString *key in keys) {
+                let value = parameters[key];
+                if (value == nil) continue;
+
+                buffer[length++] = querySeparator;
+                querySeparator = '&';
+
+                length += EncodeString(key, QueryCharacterMask, buffer + length);
+                buffer[length++] = '=';
+                length += EncodeString(AUTNotNil(value), QueryCharacterMask, buffer + length);
+            }
+        }
+    }
+
+    NSAssert(length <= maximumLength, @"Encoded URL overflowed its buffer, this is programmer error");
+
+    let string = [[NSString alloc] initWithBytes:buffer length:length encoding:NSUTF8StringEncoding];
+
+    if (buffer != stackBuffer) free(buffer);
+
+    return (string != nil) ? [NSURL URLWithString:AUTNotNil(string)] : nil;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
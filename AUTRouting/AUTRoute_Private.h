@@ -7,9 +7,37 @@
 //
 
 #import <AUTRouting/AUTRoute.h>
+#import <AUTRouting/AUTRouteSegments.h>
+#import <AUTRouting/AUTStaticRouteTable.h>
+
+@class AUTRouteTemplate;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// The usage counters of a route. Safe to use from any thread.
+@interface AUTRouteCounters : NSObject
+
+/// The number of times that the route has been selected to handle components.
+@property (nonatomic, readonly) uint64_t hitCount;
+
+/// The number of times that the route matched some but not all of its path
+/// components, or all of its path components but not its required query keys.
+@property (nonatomic, readonly) uint64_t nearMissCount;
+
+/// The cumulative time between the route's handler being invoked and its
+/// signal terminating or routing being cancelled.
+@property (nonatomic, readonly) NSTimeInterval handlerDuration;
+
+/// Increment the receiver's counters.
+- (void)recordHit;
+- (void)recordNearMiss;
+- (void)recordHandlerDuration:(NSTimeInterval)duration;
+
+/// Resets all of the receiver's counters to zero.
+- (void)reset;
+
+@end
+
 @interface AUTRoute ()
 
 typedef RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * _Nonnull (^AUTRouteHandlerBlock)(NSDictionary<NSString *, NSString *> *, id _Nullable, NSArray<NSString *> *, NSURL *);
@@ -18,6 +46,26 @@ typedef RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * _Nonn
 
 @property (nonatomic, copy, readonly) AUTRouteHandlerBlock handler;
 
+/// Initializes a route that is handled by a function rather than a block, which
+/// is invoked with the target of the AUTRoutes that matched it.
+///
+/// @param table The static route table that declares the route.
+///
+/// @param index The index of the route in the table.
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components staticHandler:(AUTStaticRouteHandler)staticHandler table:(AUTStaticRouteTable *)table index:(NSUInteger)index;
+
+/// The function that handles the receiver, or NULL if it is handled by a
+/// block.
+@property (nonatomic, readonly, nullable) AUTStaticRouteHandler staticHandler;
+
+/// The static route table that declares the receiver, or nil if it is not a
+/// static route.
+@property (nonatomic, readonly, weak, nullable) AUTStaticRouteTable *staticRouteTable;
+
+/// The index of the receiver in its static route table, or NSNotFound if it is
+/// not a static route.
+@property (nonatomic, readonly) NSUInteger staticRouteIndex;
+
 /// Matches the given components array with the internal route pattern and
 /// returns the length of the match. Returns 0 if the handler command is not
 /// enabled, or if the internal components are longer than the input components.
@@ -25,6 +73,67 @@ typedef RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * _Nonn
 /// An exception is thrown if a zero-element array is provided.
 - (NSInteger)matchingCountWithComponents:(NSArray<NSString *> *)components;
 
+/// The number of path components at the start of the receiver's components,
+/// which precede any query keys.
+@property (nonatomic, readonly) NSUInteger pathComponentCount;
+
+/// The number of the receiver's path components that are not dynamic.
+@property (nonatomic, readonly) NSUInteger staticComponentCount;
+
+/// The interned identifier of the receiver's first path component, or
+/// AUTRouteSegmentIDDynamic if it is dynamic.
+@property (nonatomic, readonly) AUTRouteSegmentID firstSegmentID;
+
+/// The usage counters of the receiver.
+///
+/// Static routes are shared by every AUTRoutes that uses their table, so are
+/// instead counted separately by each of them.
+///
+/// @see -[AUTRoutes countersForRoute:]
+@property (nonatomic, readonly) AUTRouteCounters *counters;
+
+/// An estimate of the number of bytes used to store the receiver's pattern.
+@property (nonatomic, readonly) NSUInteger segmentByteCount;
+
+/// An estimate of the number of bytes used by the receiver's caches: its cached
+/// next routables, resolved context handlers and compiled URL template.
+@property (nonatomic, readonly) NSUInteger cacheByteCount;
+
+/// Discards all of the receiver's caches, which are rebuilt as needed.
+- (void)purgeCaches;
+
+/// The classes of context object that the receiver has handlers for, sorted by
+/// name, or an empty array if the receiver does not require a context object.
+@property (nonatomic, copy, readonly) NSArray<Class> *contextClasses;
+
+/// The query keys that the receiver declares, or nil if none.
+@property (nonatomic, copy, readonly, nullable) NSArray<NSString *> *requiredQueryKeys;
+@property (nonatomic, copy, readonly, nullable) NSArray<NSString *> *optionalQueryKeys;
+
+/// The receiver's pattern compiled for generating URLs, which is compiled the
+/// first time it is accessed.
+@property (nonatomic, readonly) AUTRouteTemplate *URLTemplate;
+
+/// Whether the receiver declares any query keys.
+@property (nonatomic, readonly) BOOL hasQueryKeys;
+
+/// Whether the provided query parameters contain each of the receiver's
+/// required query keys. Always YES if the receiver declares no query keys.
+- (BOOL)matchesQueryParameters:(NSDictionary<NSString *, NSString *> *)queryParameters;
+
+/// Like -matchingCountWithComponents:, but matches against the interned
+/// identifiers of the components rather than the component strings.
+///
+/// Allows the components to be looked up once and then matched against many
+/// routes.
+///
+/// @param segmentIDs The identifiers of the components to match, as populated
+///        by AUTRouteSegmentLookup.
+///
+/// @param count The number of identifiers in segmentIDs. An exception is thrown
+///        if zero is provided.
+- (NSInteger)matchingCountWithSegmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count;
+
 /// Handles the given components.
 ///
 /// @param components The components to handle. An exception is thrown if a
@@ -40,6 +149,17 @@ typedef RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * _Nonn
 ///         failed, will error with the cause of the failure.
 - (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components context:(nullable id)context URL:(NSURL *)url;
 
+/// Returns the parameters that the receiver's handler is invoked with for the
+/// provided components, which the receiver matched the given number of.
+///
+/// Extracted while matching, on the matching scheduler if there is one, so
+/// that handlers only run once their parameters are ready.
+- (NSDictionary<NSString *, NSString *> *)parametersForComponents:(NSArray<NSString *> *)components matchLength:(NSInteger)matchLength queryParameters:(nullable NSDictionary<NSString *, NSString *> *)queryParameters;
+
+/// Invokes the receiver's handler with parameters that have already been
+/// extracted from matched components, e.g. those of a routing snapshot.
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleParameters:(NSDictionary<NSString *, NSString *> *)parameters remainingComponents:(NSArray<NSString *> *)remainingComponents context:(nullable id)context URL:(NSURL *)url target:(nullable id)target;
+
 @end
 
 NS_ASSUME_NONNULL_END
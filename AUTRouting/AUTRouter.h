@@ -8,17 +8,80 @@
 
 @import ReactiveObjC;
 
+#import <AUTRouting/AUTRoutingInterceptor.h>
+#import <AUTRouting/NSURL+AUTRouting.h>
+
 @class AUTRoutes;
+@class AUTRoutingSnapshot;
+@class AUTRoutingTraceRecorder;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Determines how a router handles a URL that is routed to while routing to a
+/// previous URL is still in progress.
+typedef NS_ENUM(NSInteger, AUTRouterConcurrencyPolicy) {
+    /// The more recent URL is rejected, as the router's handleURL command is
+    /// disabled while it is executing.
+    AUTRouterConcurrencyPolicyRejectNewest,
+
+    /// Routing to the previous URL is cancelled by disposing of its route
+    /// handler signals, and the more recent URL is routed to in its place.
+    ///
+    /// The cancelled execution signal errors in the AUTRoutingErrorDomain
+    /// domain with the AUTRoutingErrorCodeCancelled code.
+    AUTRouterConcurrencyPolicyLatestWins,
+};
+
+/// Determines how a router coalesces URLs that are routed to within its
+/// coalescing interval.
+typedef NS_ENUM(NSInteger, AUTRouterCoalescingPolicy) {
+    /// URLs that are equal to a URL that is waiting to be routed to are merged
+    /// into it, sharing a single routing. Other URLs are routed to separately.
+    AUTRouterCoalescingPolicyMergeEqualURLs,
+
+    /// Each URL replaces the URL that is waiting to be routed to, if any, so
+    /// that only the most recent URL is routed to.
+    AUTRouterCoalescingPolicyLatestReplaces,
+};
+
+/// Determines which context object is routed with when equal URLs are merged.
+typedef NS_ENUM(NSInteger, AUTRouterCoalescedContextPolicy) {
+    /// The context of the first URL is kept.
+    AUTRouterCoalescedContextPolicyKeepFirst,
+
+    /// The context of the most recent URL with a non-nil context is kept.
+    AUTRouterCoalescedContextPolicyKeepLatest,
+};
+
 /// Responsible for performing routing operations through a routing tree.
 @interface AUTRouter : NSObject
 
 - (instancetype)init NS_UNAVAILABLE;
 
 /// @param routes The root routes in the tree of routes.
-- (instancetype)initWithRootRoutes:(AUTRoutes *)routes NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithRootRoutes:(AUTRoutes *)routes;
+
+/// Initializes a router with several independent trees of routes, e.g. for the
+/// separate entry points of an application.
+///
+/// The first hop of each URL is matched against a single index of the first
+/// path components of every root's routes, and is handled by the first root in
+/// the provided order that has a matching route. If none do, it is handled by
+/// the first root with a fallback handler. Subsequent hops are routed within
+/// the tree of the root that handled the first.
+///
+/// If no root can handle the first hop, routing errors once in the
+/// AUTRoutingErrorDomain domain with the AUTRoutingErrorCodeNoMatchFound code,
+/// with the reason that each root failed populated for the
+/// AUTRoutingErrorRootFailureReasonsKey.
+///
+/// @param rootRoutes The root routes of each tree, in order of priority. An
+///        exception is thrown if empty.
+- (instancetype)initWithRootRoutesInOrder:(NSArray<AUTRoutes *> *)rootRoutes NS_DESIGNATED_INITIALIZER;
+
+/// The root routes of each of the receiver's trees of routes, in order of
+/// priority.
+@property (readonly, nonatomic, copy) NSArray<AUTRoutes *> *rootRoutes;
 
 /// When executed with a tuple, where the first is the URL to handle and
 /// the second parameter is an optional context object, handles the provided
@@ -43,6 +106,142 @@ NS_ASSUME_NONNULL_BEGIN
 /// sends the inputted tuple and completes if successful.
 @property (readonly, nonatomic) RACCommand<RACTwoTuple<NSURL *, id> *, RACTwoTuple<NSURL *, id> *> *handleURL;
 
+/// How the receiver handles a URL that is routed to while routing to a
+/// previous URL is still in progress.
+///
+/// Defaults to AUTRouterConcurrencyPolicyRejectNewest.
+@property (nonatomic) AUTRouterConcurrencyPolicy concurrencyPolicy;
+
+/// The maximum amount of time that a single route handler may take to send its
+/// next routable or complete, or zero for no limit.
+///
+/// If a route handler exceeds this deadline, its signal is disposed and routing
+/// errors in the AUTRoutingErrorDomain domain with the
+/// AUTRoutingErrorCodeTimedOut code.
+///
+/// Defaults to zero.
+@property (nonatomic) NSTimeInterval hopTimeout;
+
+/// The maximum amount of time that routing to a URL may take in total, or zero
+/// for no limit.
+///
+/// If routing exceeds this deadline, the in-progress route handler signal is
+/// disposed and routing errors in the AUTRoutingErrorDomain domain with the
+/// AUTRoutingErrorCodeTimedOut code.
+///
+/// Defaults to zero.
+@property (nonatomic) NSTimeInterval timeout;
+
+/// Interceptors that are invoked synchronously as the receiver routes, in the
+/// order that they are provided.
+///
+/// Interceptors are captured when routing to a URL begins, so changes do not
+/// affect routing that is already in progress. When there are no
+/// interceptors, routing performs no interception work beyond a single nil
+/// check per hop.
+///
+/// Defaults to nil.
+@property (nonatomic, copy, nullable) NSArray<id<AUTRoutingInterceptor>> *interceptors;
+
+/// An optional recorder that a trace of each URL routed to by the receiver is
+/// added to once routing finishes, including the matched route, match time and
+/// handler time of each hop.
+///
+/// Routing is not traced if nil. Defaults to nil.
+@property (nonatomic, nullable) AUTRoutingTraceRecorder *traceRecorder;
+
+/// An optional scheduler that the receiver tokenizes URLs, matches routes and
+/// invokes interceptors on, keeping that work off of the thread that routing is
+/// started from.
+///
+/// When set, route handlers are invoked on their route's scheduler if it has
+/// one, or else on handlerScheduler, and the handleURL command's execution
+/// signals deliver their events on handlerScheduler.
+///
+/// Routing is performed synchronously on the thread that routing is started
+/// from if nil. Defaults to nil.
+@property (nonatomic, nullable) RACScheduler *matchingScheduler;
+
+/// The scheduler that route handlers are invoked on when the receiver has a
+/// matching scheduler, unless overridden by their route.
+///
+/// Defaults to the main thread scheduler.
+@property (nonatomic) RACScheduler *handlerScheduler;
+
+/// Options that adjust how the receiver splits URLs into routing components.
+///
+/// URLs are tokenized in a single pass over their bytes, as by
+/// -[NSURL aut_routingComponentsWithOptions:]. Defaults to no options.
+@property (nonatomic) AUTRoutingTokenizerOptions tokenizerOptions;
+
+/// Whether the receiver routes as deep as possible, stopping successfully at
+/// the deepest routable that handled a prefix of the URL rather than failing
+/// when no route of a subsequent routable matches.
+///
+/// When routing stops short, the execution signals of the handleURL command
+/// send a tuple with a third element, the components that were not consumed.
+/// Routing still fails if no root route matches the URL.
+///
+/// Defaults to NO.
+@property (nonatomic) BOOL routesAsDeepAsPossible;
+
+/// The window within which URLs that are routed to are coalesced, or zero to
+/// route to each URL immediately.
+///
+/// The window opens when a URL is routed to while no coalesced URL is waiting,
+/// and routing starts once it closes. Each URL routed to within the window is
+/// coalesced according to the coalescing policy, and the execution signals of
+/// every coalesced URL share the outcome of the single routing that is
+/// performed, sending the tuple of the URL and context that were routed to.
+///
+/// While coalescing with a concurrency policy of
+/// AUTRouterConcurrencyPolicyRejectNewest, URLs that cannot be coalesced with
+/// the waiting URL, or that are routed to while coalesced routing is in
+/// progress, are rejected with a RACCommandErrorNotEnabled error.
+///
+/// Defaults to zero.
+@property (nonatomic) NSTimeInterval coalescingInterval;
+
+/// How URLs routed to within the coalescing interval are coalesced.
+///
+/// Defaults to AUTRouterCoalescingPolicyMergeEqualURLs.
+@property (nonatomic) AUTRouterCoalescingPolicy coalescingPolicy;
+
+/// Which context object is routed with when equal URLs are merged.
+///
+/// Defaults to AUTRouterCoalescedContextPolicyKeepFirst.
+@property (nonatomic) AUTRouterCoalescedContextPolicy coalescedContextPolicy;
+
+/// Whether the receiver records a snapshot of the routes that handled each URL
+/// that it successfully routes to as its lastRoutingSnapshot.
+///
+/// Defaults to NO.
+@property (nonatomic) BOOL recordsRoutingSnapshots;
+
+/// A snapshot of the routes that handled the last URL that the receiver
+/// successfully routed to while recording routing snapshots, or nil if there
+/// is none.
+///
+/// URLs with a hop that was handled by a fallback handler are not recorded, as
+/// they cannot be restored without matching.
+@property (readonly, atomic, nullable) AUTRoutingSnapshot *lastRoutingSnapshot;
+
+/// Restores the provided snapshot, e.g. to rebuild the last screen after
+/// relaunching, by invoking the handler of the route of each of its hops in
+/// turn without matching any routes.
+///
+/// Handlers are invoked with an AUTRoutingRestorationContext that wraps the
+/// provided context, so that they can skip animations.
+///
+/// @param animated Whether handlers should animate the screens that they
+///        present, as reported by the restoration context.
+///
+/// @return A signal that completes once each of the snapshot's hops has been
+///         handled. Errors in the AUTRoutingErrorDomain domain with the
+///         AUTRoutingErrorCodeNoMatchFound code if a route of the snapshot no
+///         longer exists, else like the execution signals of handleURL.
+- (RACSignal *)restoreSnapshot:(AUTRoutingSnapshot *)snapshot context:(nullable id)context animated:(BOOL)animated;
+
 @end
 
 NS_ASSUME_NONNULL_END
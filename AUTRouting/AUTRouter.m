@@ -9,12 +9,19 @@
 #import "NSURL+AUTRouting.h"
 
 #import "AUTExtObjC.h"
+#import "AUTRoute_Private.h"
 #import "AUTRoutes_Private.h"
 #import "AUTLog.h"
 #import "AUTRoutable.h"
+#import "AUTRoutableConformance.h"
 #import "AUTRoutingErrors.h"
+#import "AUTRoutingRequest.h"
+#import "AUTRoutingRestorationContext.h"
+#import "AUTRoutingSnapshot.h"
+#import "AUTRoutingTime.h"
+#import "AUTRoutingTrace.h"
 
-#import "AUTRouter.h"
+#import "AUTRouter_Private.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -46,13 +53,166 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
     return [NSError errorWithDomain:AUTRoutingErrorDomain code:code userInfo:userInfo];
 }
 
+/// Returns a signal that forwards the events of the provided signal until the
+/// interruptions signal sends a value, at which point the subscription to the
+/// provided signal is disposed and the returned signal errors with the error
+/// returned from the error block.
+static RACSignal *InterruptibleSignal(RACSignal *signal, RACSignal *interruptions, NSError *(^errorBlock)(void)) {
+    AUTCAssertNotNil(signal, interruptions, errorBlock);
+
+    return [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+        let disposable = [RACCompoundDisposable compoundDisposable];
+
+        [disposable addDisposable:[[interruptions take:1] subscribeNext:^(id _) {
+            [disposable dispose];
+            [subscriber sendError:errorBlock()];
+        }]];
+
+        [disposable addDisposable:[signal subscribe:subscriber]];
+
+        return disposable;
+    }];
+}
+
+/// A URL that is waiting to be routed to once the coalescing window closes,
+/// along with the URLs that have been coalesced into it.
+@interface AUTRouterCoalescedRouting : NSObject
+
+@property (nonatomic) NSURL *URL;
+
+@property (nonatomic, nullable) id context;
+
+/// Replays the outcome of routing to every coalesced URL.
+@property (readonly, nonatomic) RACReplaySubject<RACTwoTuple<NSURL *, id> *> *outcome;
+
+@end
+
+@implementation AUTRouterCoalescedRouting
+
+- (instancetype)initWithURL:(NSURL *)url context:(nullable id)context {
+    self = [super init];
+
+    _URL = url;
+    _context = context;
+    _outcome = [RACReplaySubject subject];
+
+    return self;
+}
+
+@end
+
+/// The roots of a router indexed by the first path component of each of their
+/// routes, so that components are only matched against the roots that have a
+/// route that can match them.
+@interface AUTRouterRootIndex : NSObject
+
+- (instancetype)initWithRootRoutes:(NSArray<AUTRoutes *> *)rootRoutes;
+
+/// Whether the routes of each root are still those that the receiver was
+/// created from.
+@property (readonly, nonatomic, getter=isCurrent) BOOL current;
+
+/// Returns the indexes of the roots with a route that can match components
+/// beginning with the segment with the provided identifier.
+- (NSIndexSet *)rootIndexesForSegmentID:(AUTRouteSegmentID)segmentID;
+
+@end
+
+@implementation AUTRouterRootIndex {
+    NSArray<AUTRoutes *> *_rootRoutes;
+
+    /// The dynamic routes of each root when the receiver was created.
+    NSArray<NSSet<AUTRoute *> *> *_snapshots;
+
+    NSDictionary<NSNumber *, NSIndexSet *> *_rootIndexesBySegmentID;
+
+    /// The roots with a route that begins with a dynamic component, which can
+    /// match any components.
+    NSIndexSet *_dynamicRootIndexes;
+}
+
+- (instancetype)initWithRootRoutes:(NSArray<AUTRoutes *> *)rootRoutes {
+    AUTAssertNotNil(rootRoutes);
+
+    self = [super init];
+
+    let snapshots = [NSMutableArray<NSSet<AUTRoute *> *> arrayWithCapacity:rootRoutes.count];
+    let rootIndexesBySegmentID = [NSMutableDictionary<NSNumber *, NSMutableIndexSet *> dictionary];
+    let dynamicRootIndexes = [NSMutableIndexSet indexSet];
+
+    for (NSUInteger rootIndex = 0; rootIndex < rootRoutes.count; rootIndex++) {
+        let routes = rootRoutes[rootIndex];
+        let dynamicRoutes = routes.dynamicRoutes;
+        [snapshots addObject:dynamicRoutes];
+
+        let staticRoutes = routes.staticRouteTable.routes ?: @[];
+        for (AUTRoute *route in [staticRoutes arrayByAddingObjectsFromArray:dynamicRoutes.allObjects]) {
+            let segmentID = route.firstSegmentID;
+
+            if (segmentID == AUTRouteSegmentIDDynamic) {
+                [dynamicRootIndexes addIndex:rootIndex];
+                continue;
+            }
+
+            var rootIndexes = rootIndexesBySegmentID[@(segmentID)];
+            if (rootIndexes == nil) {
+                rootIndexes = [NSMutableIndexSet indexSet];
+                rootIndexesBySegmentID[@(segmentID)] = rootIndexes;
+            }
+
+            [rootIndexes addIndex:rootIndex];
+        }
+    }
+
+    for (NSMutableIndexSet *rootIndexes in rootIndexesBySegmentID.objectEnumerator) {
+        [rootIndexes addIndexes:dynamicRootIndexes];
+    }
+
+    _rootRoutes = [rootRoutes copy];
+    _snapshots = [snapshots copy];
+    _rootIndexesBySegmentID = [rootIndexesBySegmentID copy];
+    _dynamicRootIndexes = [dynamicRootIndexes copy];
+
+    return self;
+}
+
+- (BOOL)isCurrent {
+    for (NSUInteger rootIndex = 0; rootIndex < _rootRoutes.count; rootIndex++) {
+        if (_rootRoutes[rootIndex].dynamicRoutes != _snapshots[rootIndex]) return NO;
+    }
+
+    return YES;
+}
+
+- (NSIndexSet *)rootIndexesForSegmentID:(AUTRouteSegmentID)segmentID {
+    return _rootIndexesBySegmentID[@(segmentID)] ?: _dynamicRootIndexes;
+}
+
+@end
+
 @interface AUTRouter ()
 
-@property (readonly, nonatomic) AUTRoutes *routes;
+/// Sends whenever routing to a URL begins while the receiver has a concurrency
+/// policy of AUTRouterConcurrencyPolicyLatestWins, interrupting routing that is
+/// still in progress.
+@property (readonly, nonatomic) RACSubject *routingCancellations;
+
+/// The URLs that are waiting for their coalescing window to close, in the order
+/// that they were first routed to. Also guards coalescedRoutingCount.
+@property (readonly, nonatomic) NSMutableArray<AUTRouterCoalescedRouting *> *pendingCoalescedRoutings;
+
+/// The number of coalesced routings that are in progress.
+@property (nonatomic) NSUInteger coalescedRoutingCount;
+
+@property (readwrite, atomic, nullable) AUTRoutingSnapshot *lastRoutingSnapshot;
 
 @end
 
-@implementation AUTRouter
+@implementation AUTRouter {
+    /// The index of the first path components of the routes of each root, or
+    /// nil if it has not yet been created. Guarded by self.
+    AUTRouterRootIndex * _Nullable _rootIndex;
+}
 
 #pragma mark - Lifecycle
 
@@ -61,9 +221,20 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
 - (instancetype)initWithRootRoutes:(AUTRoutes *)routes {
     AUTAssertNotNil(routes);
 
+    return [self initWithRootRoutesInOrder:@[ routes ]];
+}
+
+- (instancetype)initWithRootRoutesInOrder:(NSArray<AUTRoutes *> *)rootRoutes {
+    AUTAssertNotNil(rootRoutes);
+    NSParameterAssert(rootRoutes.count > 0);
+
     self = [super init];
 
-    _routes = routes;
+    _rootRoutes = [rootRoutes copy];
+    _routes = AUTNotNil(rootRoutes.firstObject);
+    _routingCancellations = [RACSubject subject];
+    _pendingCoalescedRoutings = [NSMutableArray array];
+    _handlerScheduler = RACScheduler.mainThreadScheduler;
     _handleURL = [self createHandleURLCommand];
 
     return self;
@@ -71,40 +242,342 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
 
 #pragma mark - AUTRouter
 
+- (void)setConcurrencyPolicy:(AUTRouterConcurrencyPolicy)concurrencyPolicy {
+    _concurrencyPolicy = concurrencyPolicy;
+
+    [self updateAllowsConcurrentExecution];
+}
+
+- (void)setCoalescingInterval:(NSTimeInterval)coalescingInterval {
+    _coalescingInterval = coalescingInterval;
+
+    [self updateAllowsConcurrentExecution];
+}
+
+/// The handleURL command must accept concurrent executions both to cancel
+/// routing in favor of the latest URL and to coalesce URLs into a pending
+/// routing.
+- (void)updateAllowsConcurrentExecution {
+    self.handleURL.allowsConcurrentExecution = (self.concurrencyPolicy == AUTRouterConcurrencyPolicyLatestWins || self.coalescingInterval > 0);
+}
+
 - (RACCommand<RACTwoTuple<NSURL *, id> *, RACTwoTuple<NSURL *, id> *> *)createHandleURLCommand {
     @weakify(self);
     
     return [[RACCommand alloc] initWithSignalBlock:^(RACTwoTuple<NSURL *, id> *urlAndContext) {
         @strongifyOr(self) return [RACSignal empty];
+
         let url = AUTNotNil(urlAndContext.first);
-        id context = urlAndContext.second;
 
-        if (!url.aut_isRoutable) {
-            AUTLogRoutingError(@"%@ unable to handle route to %@, no components could be extracted", self_weak_, url);
+        if (self.coalescingInterval > 0) {
+            return [self coalescedRoutingSignalForURL:url context:urlAndContext.second];
+        }
+
+        return [self routingSignalForURL:url context:urlAndContext.second];
+    }];
+}
 
-            return [RACSignal error:RoutingFailedError(@"URL is not routable", AUTRoutingErrorCodeInvalidURL, nil, context, url, nil)];
+- (RACSignal *)restoreSnapshot:(AUTRoutingSnapshot *)snapshot context:(nullable id)context animated:(BOOL)animated {
+    AUTAssertNotNil(snapshot);
+
+    return [RACSignal defer:^{
+        let url = snapshot.URL;
+
+        if (snapshot.hops.count == 0 || snapshot.rootIndex >= self.rootRoutes.count) {
+            AUTLogRoutingError(@"%@ unable to restore %@, the snapshot does not match its roots", self, url);
+
+            return [RACSignal error:RoutingFailedError(@"Snapshot does not match the router's roots", AUTRoutingErrorCodeNoMatchFound, snapshot.components, context, url, nil)];
         }
 
-        let components = url.aut_routingComponents;
+        AUTLogRoutingInfo(@"%@ restoring %@ (hops: %lu), context: %@", self, url, (unsigned long)snapshot.hops.count, context);
 
-        return [[[[[self handleComponents:components withRoutes:self.routes context:context URL:url]
-            initially:^{
-                AUTLogRoutingInfo(@"%@ started routing to %@ (components: %@), context: %@", self_weak_, url, ComponentsDescription(components), context);
-            }]
-            doCompleted:^{
-                AUTLogRoutingInfo(@"%@ finished routing to %@ (components: %@), context: %@", self_weak_, url, ComponentsDescription(components), context);
-            }]
-            doError:^(NSError *error) {
-                AUTLogRoutingError(@"%@ error routing to %@ (components: %@), context: %@, error: %@", self_weak_, url, ComponentsDescription(components), context, error);
-            }]
-            then:^{
-                return [RACSignal return:urlAndContext];
-            }];
+        let restorationContext = [[AUTRoutingRestorationContext alloc] initWithContext:context animated:animated];
+        let routes = self.rootRoutes[snapshot.rootIndex];
+
+        return [self restoreHopAtIndex:0 ofSnapshot:snapshot withRoutes:routes target:nil context:restorationContext];
     }];
 }
 
-- (RACSignal *)handleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes context:(nullable id)context URL:(NSURL *)url {
-    AUTAssertNotNil(components, routes, url);
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url context:(nullable id)context {
+    AUTAssertNotNil(url);
+
+    return [self routingSignalForURL:url tokenizedComponents:nil context:context];
+}
+
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url components:(NSArray<NSString *> *)components context:(nullable id)context {
+    AUTAssertNotNil(url, components);
+
+    return [self routingSignalForURL:url tokenizedComponents:components context:context];
+}
+
+/// Returns a signal that routes to the provided URL when subscribed to, on the
+/// receiver's matching scheduler if it has one.
+///
+/// @param tokenizedComponents The components of the URL if it has already been
+///        tokenized, or nil to tokenize it.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url tokenizedComponents:(nullable NSArray<NSString *> *)tokenizedComponents context:(nullable id)context {
+    AUTAssertNotNil(url);
+
+    let matchingScheduler = self.matchingScheduler;
+    if (matchingScheduler == nil) {
+        return [RACSignal defer:^{
+            return [self startRoutingToURL:url tokenizedComponents:tokenizedComponents context:context matchingScheduler:nil handlerScheduler:nil];
+        }];
+    }
+
+    let handlerScheduler = self.handlerScheduler;
+
+    return [[[RACSignal
+        defer:^{
+            return [self startRoutingToURL:url tokenizedComponents:tokenizedComponents context:context matchingScheduler:matchingScheduler handlerScheduler:handlerScheduler];
+        }]
+        subscribeOn:AUTNotNil(matchingScheduler)]
+        deliverOn:handlerScheduler];
+}
+
+/// Begins routing to the provided URL, returning a signal with the semantics of
+/// the handleURL command's execution signals.
+///
+/// @param tokenizedComponents The components of the URL if it has already been
+///        tokenized, or nil to tokenize it. Ignored if an interceptor rewrites
+///        the URL before it is tokenized.
+///
+/// @param matchingScheduler The scheduler to match each hop on, or nil to match
+///        each hop on the thread that the previous hop finished on.
+///
+/// @param handlerScheduler The scheduler to invoke route handlers on, or nil to
+///        invoke them on the thread that they were matched on.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)startRoutingToURL:(NSURL *)originalURL tokenizedComponents:(nullable NSArray<NSString *> *)tokenizedComponents context:(nullable id)context matchingScheduler:(nullable RACScheduler *)matchingScheduler handlerScheduler:(nullable RACScheduler *)handlerScheduler {
+    AUTAssertNotNil(originalURL);
+
+    let urlAndContext = (RACTwoTuple<NSURL *, id> *)RACTuplePack(originalURL, context);
+    let request = [[AUTRoutingRequest alloc] initWithURL:originalURL context:context interceptors:self.interceptors];
+    request.matchingScheduler = matchingScheduler;
+    request.handlerScheduler = handlerScheduler;
+
+    NSArray<NSString *> *components;
+    RACSignal *routing;
+
+    NSError *interceptionError;
+    if (request.interceptors == nil || [self interceptRequestBeforeTokenizing:request error:&interceptionError]) {
+        if (tokenizedComponents != nil && request.URL == originalURL) {
+            components = AUTNotNil(tokenizedComponents);
+        } else {
+            components = [request.URL aut_routingComponentsWithOptions:self.tokenizerOptions];
+        }
+
+        if (components.count == 0) {
+            AUTLogRoutingError(@"%@ unable to handle route to %@, no components could be extracted", self, request.URL);
+
+            return [RACSignal error:RoutingFailedError(@"URL is not routable", AUTRoutingErrorCodeInvalidURL, nil, context, request.URL, nil)];
+        }
+
+        if (self.recordsRoutingSnapshots) {
+            [request beginSnapshottingWithComponentCount:components.count];
+        }
+
+        routing = [self handleRootComponents:components request:request];
+    } else {
+        AUTLogRoutingInfo(@"%@ routing to %@ was stopped by an interceptor", self, request.URL);
+
+        // Stopped routing is still subject to the deadline and cancellation
+        // below, and is logged and traced like any other routing.
+        components = @[];
+        routing = (interceptionError != nil) ? [RACSignal error:interceptionError] : [RACSignal empty];
+    }
+
+    let url = request.URL;
+
+    let traceRecorder = self.traceRecorder;
+    if (traceRecorder != nil) {
+        [request beginTracing];
+    }
+
+    if (self.timeout > 0) {
+        routing = [self routing:routing withTimeout:self.timeout components:nil request:request];
+    }
+
+    if (self.concurrencyPolicy == AUTRouterConcurrencyPolicyLatestWins) {
+        // Interrupt any routing that is already in progress before this
+        // routing starts listening for interruptions of its own.
+        [self.routingCancellations sendNext:url];
+
+        routing = InterruptibleSignal(routing, self.routingCancellations, ^{
+            return RoutingFailedError(@"Routing was cancelled by a more recent URL", AUTRoutingErrorCodeCancelled, nil, context, url, nil);
+        });
+    }
+
+    if (traceRecorder != nil) {
+        routing = [self routing:routing recordingTraceOfRequest:request components:components recorder:AUTNotNil(traceRecorder)];
+    }
+
+    @weakify(self);
+
+    return [[[[routing
+        initially:^{
+            AUTLogRoutingInfo(@"%@ started routing to %@ (components: %@), context: %@", self_weak_, url, ComponentsDescription(components), context);
+        }]
+        doCompleted:^{
+            AUTLogRoutingInfo(@"%@ finished routing to %@ (components: %@), context: %@", self_weak_, url, ComponentsDescription(components), context);
+        }]
+        doError:^(NSError *error) {
+            AUTLogRoutingError(@"%@ error routing to %@ (components: %@), context: %@, error: %@", self_weak_, url, ComponentsDescription(components), context, error);
+        }]
+        then:^{
+            if (request.snapshotting) {
+                [self_weak_ recordSnapshotOfRequest:request components:components];
+            }
+
+            let unconsumedComponents = request.unconsumedComponents;
+            if (unconsumedComponents != nil) {
+                return [RACSignal return:RACTuplePack(originalURL, context, unconsumedComponents)];
+            }
+
+            return [RACSignal return:urlAndContext];
+        }];
+}
+
+#pragma mark Roots
+
+/// Handles the provided components with the receiver's root, or with the
+/// highest priority of its roots that can handle them.
+- (RACSignal *)handleRootComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(components, request);
+
+    if (self.rootRoutes.count == 1) {
+        request.rootRoutes = self.routes;
+        return [self handleComponents:components withRoutes:self.routes target:nil request:request];
+    }
+
+    var routing = [RACSignal defer:^{
+        NSError *error;
+        let routes = [self rootRoutesForComponents:components request:request error:&error];
+        if (routes == nil) return [RACSignal error:error];
+
+        request.rootRoutes = routes;
+
+        return [self handleComponents:components withRoutes:AUTNotNil(routes) target:nil request:request];
+    }];
+
+    // Roots are selected on the matching scheduler, like any other matching.
+    let matchingScheduler = request.matchingScheduler;
+    if (matchingScheduler != nil) {
+        routing = [routing subscribeOn:AUTNotNil(matchingScheduler)];
+    }
+
+    return routing;
+}
+
+/// Returns the highest priority root with a route that matches the provided
+/// components, else the highest priority root with a fallback handler, else
+/// nil with a NoMatchFound error that has the reason that each root failed.
+///
+/// Roots are selected by path components alone, so a root is not passed over
+/// because of its routes' query keys.
+- (nullable AUTRoutes *)rootRoutesForComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request error:(NSError **)error {
+    AUTAssertNotNil(components, request);
+
+    let rootRoutes = self.rootRoutes;
+
+    let count = components.count;
+    AUTRouteSegmentID stackSegmentIDs[AUTRouteSegmentStackBufferCount];
+    AUTRouteSegmentID *segmentIDs = (count <= AUTRouteSegmentStackBufferCount) ? stackSegmentIDs : malloc(count * sizeof(AUTRouteSegmentID));
+    AUTRouteSegmentLookup(components, segmentIDs);
+
+    let candidateIndexes = [self.rootIndex rootIndexesForSegmentID:segmentIDs[0]];
+
+    AUTRoutes * _Nullable matchingRoutes;
+    for (NSUInteger index = candidateIndexes.firstIndex; index != NSNotFound; index = [candidateIndexes indexGreaterThanIndex:index]) {
+        let routes = rootRoutes[index];
+
+        if ([routes matchingRouteForSegmentIDs:segmentIDs count:count request:nil matchLength:NULL] != nil) {
+            matchingRoutes = routes;
+            break;
+        }
+    }
+
+    if (segmentIDs != stackSegmentIDs) free(segmentIDs);
+
+    if (matchingRoutes != nil) return matchingRoutes;
+
+    for (AUTRoutes *routes in rootRoutes) {
+        if (routes.fallbackHandler != nil) return routes;
+    }
+
+    let reasons = [NSMutableArray<NSString *> arrayWithCapacity:rootRoutes.count];
+    for (NSUInteger index = 0; index < rootRoutes.count; index++) {
+        if ([candidateIndexes containsIndex:index]) {
+            [reasons addObject:[NSString stringWithFormat:@"No route matches %@", ComponentsDescription(components)]];
+        } else {
+            [reasons addObject:[NSString stringWithFormat:@"No route begins with %@", components.firstObject]];
+        }
+    }
+
+    AUTLogRoutingError(@"%@ unable to route to %@, none of its roots match: %@", self, ComponentsDescription(components), reasons);
+
+    if (error != NULL) {
+        let routingError = RoutingFailedError(@"No matching route found", AUTRoutingErrorCodeNoMatchFound, components, request.context, request.URL, nil);
+
+        NSMutableDictionary<NSString *, id> *userInfo = [routingError.userInfo mutableCopy];
+        userInfo[AUTRoutingErrorRootFailureReasonsKey] = [reasons copy];
+
+        *error = [NSError errorWithDomain:routingError.domain code:routingError.code userInfo:userInfo];
+    }
+
+    return nil;
+}
+
+/// The index of the receiver's roots, which is recreated when the routes of
+/// any of the roots change.
+- (AUTRouterRootIndex *)rootIndex {
+    @synchronized (self) {
+        if (_rootIndex == nil || !_rootIndex.isCurrent) {
+            _rootIndex = [[AUTRouterRootIndex alloc] initWithRootRoutes:self.rootRoutes];
+        }
+
+        return AUTNotNil(_rootIndex);
+    }
+}
+
+#pragma mark Hops
+
+/// Handles the provided components with the given routes.
+///
+/// @param target The target that static route handlers are invoked with, or
+///        nil to use the target of the routes.
+- (RACSignal *)handleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes target:(nullable id)target request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(components, routes, request);
+    NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
+
+    // Hops after the first begin on the thread that the previous route handler
+    // sent its next routable on, so move them back to the matching scheduler.
+    let matchingScheduler = request.matchingScheduler;
+    if (matchingScheduler != nil && RACScheduler.currentScheduler != matchingScheduler) {
+        return [[self interceptAndRouteComponents:components withRoutes:routes target:target request:request] subscribeOn:AUTNotNil(matchingScheduler)];
+    }
+
+    return [self interceptAndRouteComponents:components withRoutes:routes target:target request:request];
+}
+
+- (RACSignal *)interceptAndRouteComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes target:(nullable id)target request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(components, routes, request);
+
+    if (request.interceptors == nil) return [self routeComponents:components withRoutes:routes target:target request:request];
+
+    return [RACSignal defer:^{
+        NSError *error;
+        let interceptedComponents = [self interceptComponents:components withRoutes:routes request:request error:&error];
+
+        if (interceptedComponents.count == 0) {
+            return (error != nil) ? [RACSignal error:error] : [RACSignal empty];
+        }
+
+        return [self routeComponents:AUTNotNil(interceptedComponents) withRoutes:routes target:target request:request];
+    }];
+}
+
+- (RACSignal *)routeComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes target:(nullable id)target request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(components, routes, request);
     NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
 
     @weakify(self);
@@ -112,9 +585,38 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
     return [RACSignal defer:^{
         AUTLogRoutingInfo(@"%@ handling components %@", self, ComponentsDescription(components));
 
-        return [[[[[routes handleComponents:components context:context URL:url]
-            take:1]
+        let url = request.URL;
+        id context = request.context;
+
+        request.hopCount++;
+        request.hopFansOut = NO;
+        let stopsWithoutMatch = (self.routesAsDeepAsPossible && request.hopCount > 1);
+
+        // Routes send a single next routable unless they fan out, in which
+        // case each is routed to concurrently by flattening the branches.
+        var handling = [routes handleComponents:components request:request target:target];
+
+        if (request.tracing) {
+            handling = [self handling:handling tracingHopOfRequest:request];
+        }
+
+        if (self.hopTimeout > 0) {
+            handling = [self routing:handling withTimeout:self.hopTimeout components:components request:request];
+        }
+
+        if (request.interceptors != nil) {
+            handling = [self handling:handling notifyingInterceptorsOfComponents:components withRoutes:routes request:request];
+        }
+
+        return [[[handling
             catch:^(NSError *underlyingError) {
+                if (stopsWithoutMatch && [underlyingError.domain isEqualToString:AUTRoutingErrorDomain] && underlyingError.code == AUTRoutingErrorCodeNoMatchFound) {
+                    AUTLogRoutingInfo(@"%@ stopped routing short of %@", self_weak_, ComponentsDescription(components));
+
+                    request.unconsumedComponents = components;
+                    return [RACSignal empty];
+                }
+
                 AUTLogRoutingError(@"%@ error routing to %@: %@", self_weak_, ComponentsDescription(components), underlyingError);
 
                 // If the error is already a routing error, just forward it.
@@ -129,7 +631,10 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
                 // If there are no remaining components, we're done.
                 if (remainingComponents.count == 0) return [RACSignal empty];
 
-                if (![routable conformsToProtocol:@protocol(AUTRoutable)]) {
+                id target;
+                let routableRoutes = [self routesOfRoutable:routable target:&target];
+
+                if (routableRoutes == nil) {
                     AUTLogRoutingError(@"%@ unable to route to %@, %@ does not conform to %@", self_weak_, ComponentsDescription(components), routable.class, NSStringFromProtocol(@protocol(AUTRoutable)));
 
                     let description = [NSString stringWithFormat:@"%@ is not routable", routable.class];
@@ -140,13 +645,354 @@ static inline NSError *RoutingFailedError(NSString *failureReason, AUTRoutingErr
                 [handledComponents removeObjectsInArray:remainingComponents];
 
                 AUTLogRoutingInfo(@"%@ routed to %@", self_weak_, ComponentsDescription(handledComponents));
-                
-                return [self handleComponents:remainingComponents withRoutes:routable.routes context:context URL:url];
+
+                // Branches are handled concurrently, so each needs hop state
+                // of its own.
+                let nextRequest = request.hopFansOut ? [request requestForBranch] : request;
+
+                return [self handleComponents:remainingComponents withRoutes:AUTNotNil(routableRoutes) target:target request:nextRequest];
             }]
             flatten];
     }];
 }
 
+/// Returns the routes that the provided routable handles components with, or
+/// nil if it is not routable.
+///
+/// @param target Populated with the target that the routes are handled with,
+///        which is nil unless the routes are shared.
+- (nullable AUTRoutes *)routesOfRoutable:(id)routable target:(id _Nullable __autoreleasing *)target {
+    AUTAssertNotNil(routable);
+    NSParameterAssert(target != NULL);
+
+    *target = nil;
+
+    // Read from the conformance cache, so that neither protocol is checked
+    // against the runtime on each hop.
+    let conformance = AUTRoutableConformanceOfObject(routable);
+    if (conformance == AUTRoutableConformanceNone) return nil;
+    if (conformance == AUTRoutableConformanceRoutable) return [(id<AUTRoutable>)routable routes];
+
+    // Template routables share the routes of their class's template, which
+    // are handled on their behalf.
+    *target = routable;
+    return [AUTRoutes templateRoutesForRoutableClass:[routable class]];
+}
+
+#pragma mark Snapshots
+
+/// Publishes a snapshot of the routes that handled the provided request,
+/// unless any of its hops were handled by a fallback handler, which cannot be
+/// restored without matching.
+- (void)recordSnapshotOfRequest:(AUTRoutingRequest *)request components:(NSArray<NSString *> *)components {
+    AUTAssertNotNil(request, components);
+
+    let hops = AUTNotNil(request.snapshotHops);
+    let rootRoutes = request.rootRoutes;
+
+    // When routing as deep as possible, the hop that stopped short does not
+    // record a route.
+    let handledHopCount = request.hopCount - ((request.unconsumedComponents != nil) ? 1 : 0);
+    if (rootRoutes == nil || hops.count == 0 || hops.count != handledHopCount) return;
+
+    let rootIndex = [self.rootRoutes indexOfObjectIdenticalTo:AUTNotNil(rootRoutes)];
+
+    self.lastRoutingSnapshot = [[AUTRoutingSnapshot alloc] initWithURL:request.URL components:components rootIndex:rootIndex hops:hops];
+}
+
+/// Restores the hop of the provided snapshot at the given index and each of
+/// the hops after it, invoking the handler of each hop's route directly.
+- (RACSignal *)restoreHopAtIndex:(NSUInteger)index ofSnapshot:(AUTRoutingSnapshot *)snapshot withRoutes:(AUTRoutes *)routes target:(nullable id)target context:(AUTRoutingRestorationContext *)context {
+    AUTAssertNotNil(snapshot, routes, context);
+    NSAssert(index < snapshot.hops.count, @"Unable to restore a hop beyond the end of a snapshot, this is programmer error");
+
+    let hop = snapshot.hops[index];
+    let url = snapshot.URL;
+    let components = snapshot.components;
+    let hopComponents = [components subarrayWithRange:NSMakeRange(hop.componentOffset, components.count - hop.componentOffset)];
+
+    let route = [routes routeWithIdentifier:hop.routeIdentifier];
+    if (route == nil) {
+        AUTLogRoutingError(@"%@ unable to restore %@, %@ has no route %@", self, url, routes, hop.routeIdentifier);
+
+        return [RACSignal error:RoutingFailedError(@"Snapshot route not found", AUTRoutingErrorCodeNoMatchFound, hopComponents, context.context, url, nil)];
+    }
+
+    let remainingOffset = hop.componentOffset + hop.matchLength;
+    let remainingComponents = [components subarrayWithRange:NSMakeRange(remainingOffset, components.count - remainingOffset)];
+
+    var handling = [[route handleParameters:hop.parameters remainingComponents:remainingComponents context:context URL:url target:target ?: routes.target] take:1];
+
+    let scheduler = route.scheduler;
+    if (scheduler != nil) {
+        handling = [handling subscribeOn:AUTNotNil(scheduler)];
+    }
+
+    @weakify(self);
+
+    return [[[handling
+        catch:^(NSError *underlyingError) {
+            if ([underlyingError.domain isEqualToString:AUTRoutingErrorDomain]) return [RACSignal error:underlyingError];
+
+            return [RACSignal error:RoutingFailedError(@"An error occurred", AUTRoutingErrorCodeRouteHandlerFailed, hopComponents, context.context, url, underlyingError)];
+        }]
+        reduceEach:^(id<AUTRoutable> routable, NSArray<NSString *> *_) {
+            @strongifyOr(self) return [RACSignal empty];
+            AUTCAssertNotNil(routable);
+
+            if (index + 1 == snapshot.hops.count) return [RACSignal empty];
+
+            id nextTarget;
+            let nextRoutes = [self routesOfRoutable:routable target:&nextTarget];
+
+            if (nextRoutes == nil) {
+                let description = [NSString stringWithFormat:@"%@ is not routable", routable.class];
+                return [RACSignal error:RoutingFailedError(description, AUTRoutingErrorCodeNotRoutable, hopComponents, context.context, url, nil)];
+            }
+
+            return [self restoreHopAtIndex:index + 1 ofSnapshot:snapshot withRoutes:AUTNotNil(nextRoutes) target:nextTarget context:context];
+        }]
+        flatten];
+}
+
+#pragma mark Coalescing
+
+/// Coalesces routing to the provided URL with any pending URL according to the
+/// receiver's coalescing policy, returning a signal that shares the outcome of
+/// the coalesced routing.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)coalescedRoutingSignalForURL:(NSURL *)url context:(nullable id)context {
+    AUTAssertNotNil(url);
+
+    return [RACSignal defer:^{
+        AUTRouterCoalescedRouting *routing;
+        BOOL opensWindow = NO;
+
+        @synchronized (self.pendingCoalescedRoutings) {
+            routing = [self pendingRoutingCoalescingURL:url];
+
+            if (routing == nil) {
+                let isBusy = (self.pendingCoalescedRoutings.count > 0 || self.coalescedRoutingCount > 0);
+                if (isBusy && self.concurrencyPolicy == AUTRouterConcurrencyPolicyRejectNewest) {
+                    return [RACSignal error:[NSError errorWithDomain:RACCommandErrorDomain code:RACCommandErrorNotEnabled userInfo:@{
+                        NSLocalizedDescriptionKey: NSLocalizedString(@"The command is disabled and cannot be executed", nil),
+                        RACUnderlyingCommandErrorKey: self.handleURL,
+                    }]];
+                }
+
+                routing = [[AUTRouterCoalescedRouting alloc] initWithURL:url context:context];
+                [self.pendingCoalescedRoutings addObject:AUTNotNil(routing)];
+                opensWindow = YES;
+            } else if (![routing.URL isEqual:url]) {
+                AUTLogRoutingInfo(@"%@ replaced pending URL %@ with %@", self, routing.URL, url);
+
+                routing.URL = url;
+                routing.context = context;
+            } else if (context != nil && (routing.context == nil || self.coalescedContextPolicy == AUTRouterCoalescedContextPolicyKeepLatest)) {
+                routing.context = context;
+            }
+        }
+
+        if (opensWindow) {
+            [self routeCoalescedRouting:AUTNotNil(routing) afterInterval:self.coalescingInterval];
+        } else {
+            AUTLogRoutingInfo(@"%@ coalesced routing to %@", self, url);
+        }
+
+        return routing.outcome;
+    }];
+}
+
+/// Returns the pending routing that the provided URL should be coalesced into,
+/// if any. Must be called while synchronized on pendingCoalescedRoutings.
+- (nullable AUTRouterCoalescedRouting *)pendingRoutingCoalescingURL:(NSURL *)url {
+    AUTAssertNotNil(url);
+
+    if (self.coalescingPolicy == AUTRouterCoalescingPolicyLatestReplaces) {
+        return self.pendingCoalescedRoutings.lastObject;
+    }
+
+    for (AUTRouterCoalescedRouting *routing in self.pendingCoalescedRoutings) {
+        if ([routing.URL isEqual:url]) return routing;
+    }
+
+    return nil;
+}
+
+/// Routes to the URL of the provided routing once its coalescing window closes,
+/// forwarding the outcome to every coalesced URL.
+- (void)routeCoalescedRouting:(AUTRouterCoalescedRouting *)routing afterInterval:(NSTimeInterval)interval {
+    AUTAssertNotNil(routing);
+
+    let scheduler = RACScheduler.currentScheduler ?: RACScheduler.mainThreadScheduler;
+
+    [scheduler afterDelay:interval schedule:^{
+        NSURL *url;
+        id context;
+
+        @synchronized (self.pendingCoalescedRoutings) {
+            [self.pendingCoalescedRoutings removeObjectIdenticalTo:routing];
+            self.coalescedRoutingCount++;
+
+            url = routing.URL;
+            context = routing.context;
+        }
+
+        [[[self routingSignalForURL:AUTNotNil(url) context:context]
+            finally:^{
+                @synchronized (self.pendingCoalescedRoutings) {
+                    self.coalescedRoutingCount--;
+                }
+            }]
+            subscribe:routing.outcome];
+    }];
+}
+
+#pragma mark Interception
+
+/// Invokes each interceptor before the request's URL is tokenized, updating
+/// the request's URL with any rewritten URL.
+///
+/// @return Whether routing should continue.
+- (BOOL)interceptRequestBeforeTokenizing:(AUTRoutingRequest *)request error:(NSError **)error {
+    AUTAssertNotNil(request);
+
+    for (id<AUTRoutingInterceptor> interceptor in request.interceptors) {
+        if (![interceptor respondsToSelector:@selector(router:willTokenizeURL:context:annotations:error:)]) continue;
+
+        let url = [interceptor router:self willTokenizeURL:request.URL context:request.context annotations:request.annotations error:error];
+        if (url == nil) return NO;
+
+        request.URL = AUTNotNil(url);
+    }
+
+    return YES;
+}
+
+/// Invokes each interceptor before the provided components are handled.
+///
+/// @return The components to handle, or nil or an empty array if routing
+///         should stop.
+- (nullable NSArray<NSString *> *)interceptComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes request:(AUTRoutingRequest *)request error:(NSError **)error {
+    AUTAssertNotNil(components, routes, request);
+
+    NSArray<NSString *> * _Nullable interceptedComponents = components;
+
+    for (id<AUTRoutingInterceptor> interceptor in request.interceptors) {
+        if (![interceptor respondsToSelector:@selector(router:willHandleComponents:withRoutes:context:URL:annotations:error:)]) continue;
+
+        interceptedComponents = [interceptor router:self willHandleComponents:AUTNotNil(interceptedComponents) withRoutes:routes context:request.context URL:request.URL annotations:request.annotations error:error];
+        if (interceptedComponents.count == 0) return nil;
+    }
+
+    return interceptedComponents;
+}
+
+/// Invokes each interceptor once the provided handling signal has sent its
+/// next routable, or has completed without sending one.
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handling:(RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handling notifyingInterceptorsOfComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(handling, components, routes, request);
+
+    @weakify(self);
+
+    void (^notifyInterceptors)(id<AUTRoutable> _Nullable, NSArray<NSString *> * _Nullable) = ^(id<AUTRoutable> _Nullable routable, NSArray<NSString *> * _Nullable remainingComponents) {
+        @strongifyOr(self) return;
+
+        for (id<AUTRoutingInterceptor> interceptor in request.interceptors) {
+            if (![interceptor respondsToSelector:@selector(router:didHandleComponents:withRoutes:nextRoutable:remainingComponents:context:URL:annotations:)]) continue;
+
+            [interceptor router:self didHandleComponents:components withRoutes:routes nextRoutable:routable remainingComponents:remainingComponents context:request.context URL:request.URL annotations:request.annotations];
+        }
+    };
+
+    return [RACSignal defer:^{
+        __block BOOL sentRoutable = NO;
+
+        return [[handling
+            doNext:^(RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *routableAndRemainingComponents) {
+                sentRoutable = YES;
+                notifyInterceptors(routableAndRemainingComponents.first, routableAndRemainingComponents.second);
+            }]
+            doCompleted:^{
+                if (!sentRoutable) notifyInterceptors(nil, nil);
+            }];
+    }];
+}
+
+#pragma mark Tracing
+
+/// Records the total duration of the hop handled by the provided signal in the
+/// request once the signal sends its first event.
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handling:(RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handling tracingHopOfRequest:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(handling, request);
+
+    return [RACSignal defer:^{
+        let startTime = AUTRoutingMonotonicTime();
+
+        __block BOOL recorded = NO;
+        void (^recordHop)(void) = ^{
+            if (recorded) return;
+            recorded = YES;
+
+            [request recordHopDuration:AUTRoutingMonotonicTime() - startTime];
+        };
+
+        return [[[handling
+            doNext:^(id _) {
+                recordHop();
+            }]
+            doError:^(NSError *_) {
+                recordHop();
+            }]
+            doCompleted:^{
+                recordHop();
+            }];
+    }];
+}
+
+/// Adds a record of the routing performed by the provided signal to the
+/// recorder once it terminates.
+- (RACSignal *)routing:(RACSignal *)routing recordingTraceOfRequest:(AUTRoutingRequest *)request components:(NSArray<NSString *> *)components recorder:(AUTRoutingTraceRecorder *)recorder {
+    AUTAssertNotNil(routing, request, components, recorder);
+
+    return [RACSignal defer:^{
+        let startTime = AUTRoutingMonotonicTime();
+
+        void (^addRecord)(NSError * _Nullable) = ^(NSError * _Nullable error) {
+            [recorder addRecord:[[AUTRoutingTraceRecord alloc]
+                initWithComponents:components
+                hops:request.traceHops ?: @[]
+                duration:AUTRoutingMonotonicTime() - startTime
+                succeeded:(error == nil)
+                errorCode:error.code]];
+        };
+
+        return [[routing
+            doError:^(NSError *error) {
+                addRecord(error);
+            }]
+            doCompleted:^{
+                addRecord(nil);
+            }];
+    }];
+}
+
+#pragma mark Deadlines
+
+/// Errors with a routing error with the AUTRoutingErrorCodeTimedOut code if the
+/// provided routing signal does not terminate within the given timeout,
+/// disposing of its subscription.
+- (RACSignal *)routing:(RACSignal *)routing withTimeout:(NSTimeInterval)timeout components:(nullable NSArray<NSString *> *)components request:(AUTRoutingRequest *)request {
+    AUTAssertNotNil(routing, request);
+    NSParameterAssert(timeout > 0);
+
+    let deadline = [[RACSignal return:RACUnit.defaultUnit] delay:timeout];
+
+    return InterruptibleSignal(routing, deadline, ^{
+        let description = [NSString stringWithFormat:@"Routing did not finish within %gs", timeout];
+        return RoutingFailedError(description, AUTRoutingErrorCodeTimedOut, components, request.context, request.URL, nil);
+    });
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,35 @@
+//
+//  AUTRouter_Private.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <AUTRouting/AUTRouter.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface AUTRouter ()
+
+/// The routes of the root of the routing tree, or the highest priority root if
+/// the receiver has more than one.
+@property (readonly, nonatomic) AUTRoutes *routes;
+
+/// Returns a signal that routes to the provided URL when subscribed to,
+/// bypassing the receiver's handleURL command.
+///
+/// Has the same semantics as the execution signals of the handleURL command,
+/// but is not subject to the command being disabled while executing.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url context:(nullable id)context;
+
+/// Like -routingSignalForURL:context:, but handles the provided components
+/// rather than tokenizing the URL again, unless an interceptor rewrites the URL
+/// before it is tokenized.
+///
+/// @param components The routing components of the URL, tokenized with the
+///        receiver's tokenizer options.
+- (RACSignal<RACTwoTuple<NSURL *, id> *> *)routingSignalForURL:(NSURL *)url components:(NSArray<NSString *> *)components context:(nullable id)context;
+
+@end
+
+NS_ASSUME_NONNULL_END
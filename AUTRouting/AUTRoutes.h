@@ -11,11 +11,51 @@
 
 #import <AUTRouting/AUTRoute.h>
 
+@class AUTRouteStatistics;
+@class AUTRoutesMemoryUsage;
+@class AUTStaticRouteTable;
+
 NS_ASSUME_NONNULL_BEGIN
 
+/// A block invoked to handle components that none of the routes of an AUTRoutes
+/// match, with the parameters:
+/// - The components that could not be matched
+/// - An optional context object that was provided to routing
+/// - The URL that is being routed to.
+///
+/// @return A signal that sends the routable to land on, which is not routed to
+///         any further, or else completes with no value. If an error occurs,
+///         should error.
+typedef RACSignal<id<AUTRoutable>> * _Nonnull (^AUTRoutesFallbackHandlerBlock)(NSArray<NSString *> *components, id _Nullable context, NSURL *url);
+
 /// A collection of routes representing the paths that an object can handle.
 @interface AUTRoutes : NSObject
 
+- (instancetype)init;
+
+/// Initializes the receiver with the provided static route table as the
+/// immutable base layer of its routes, which routes added to the receiver are
+/// layered on top of.
+///
+/// The table's routes are not copied, so any number of AUTRoutes can share a
+/// single table. Routes added to the receiver that are equal to one of the
+/// table's routes are rejected, and the table's routes cannot be removed.
+///
+/// The usage counters of the table's routes are kept by the receiver, so only
+/// count routing through the receiver. Purging the receiver's caches leaves the
+/// table's routes untouched, as they are shared.
+///
+/// @param target The object that the table's handlers are invoked with, which
+///        is not retained, e.g. the routable that owns the receiver.
+- (instancetype)initWithStaticRouteTable:(AUTStaticRouteTable *)staticRouteTable target:(nullable id)target;
+
+/// The static route table that is the base layer of the receiver's routes, or
+/// nil if the receiver has none.
+@property (readonly, nonatomic, nullable) AUTStaticRouteTable *staticRouteTable;
+
+/// The object that the static route table's handlers are invoked with.
+@property (readonly, nonatomic, weak, nullable) id target;
+
 /// Adds a route without a context object.
 ///
 /// @see The corresponding route initializer: -[AUTRoute initWithComponents:
@@ -25,6 +65,12 @@ NS_ASSUME_NONNULL_BEGIN
 ///         receiver.
 - (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents withHandler:(AUTRouteWithoutContextHandlerBlock)handler;
 
+/// Like -addRoute:withHandler:, but the route is removed from the receiver
+/// automatically when the provided owner deallocates.
+///
+/// @see -addRoute:owner:
+- (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents owner:(id)owner withHandler:(AUTRouteWithoutContextHandlerBlock)handler;
+
 /// Like -addRoute:withHandler:, but uses the provided signal instead of a block
 /// that generates a signal.
 ///
@@ -46,16 +92,112 @@ NS_ASSUME_NONNULL_BEGIN
 
 /// Adds a route that requires a context object of the given class.
 ///
+/// If a route with the same components that requires a context object was
+/// already added to the receiver, the handler is added to that route for the
+/// given context class instead.
+///
 /// @see The corresponding route initializer: -[AUTRoute initWithComponents:
 ///      contextClass:handler:].
 ///
+/// @see -[AUTRoute addHandler:forContextClass:]
+///
+/// @return The added or existing route, or else nil if the route was already
+///         added to the receiver without a context class, or already has a
+///         handler for the context class.
+- (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents withContextClass:(Class)contextClass handler:(AUTRouteWithContextHandlerBlock)handler;
+
+/// Like -addRoute:withHandler:, but adds an idempotent route, which invokes
+/// its handler once per set of parameters and then sends the cached next
+/// routable until it expires or is deallocated.
+///
+/// @param lifetime The amount of time that a cached next routable is used for,
+///        or zero for no limit.
+///
+/// @see -[AUTRoute idempotent]
+///
 /// @return The added route, or else nil if the route was already added to the
 ///         receiver.
-- (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents withContextClass:(Class)contextClass handler:(AUTRouteWithContextHandlerBlock)handler;
+- (nullable AUTRoute *)addIdempotentRoute:(NSArray<NSString *> *)routeComponents cachedRoutableLifetime:(NSTimeInterval)lifetime withHandler:(AUTRouteWithoutContextHandlerBlock)handler;
+
+/// Like -addRoute:withHandler:, but adds a fan-out route, each of whose next
+/// routables is routed to concurrently as a separate branch.
+///
+/// @see -[AUTRoute fansOut]
+///
+/// @return The added route, or else nil if the route was already added to the
+///         receiver.
+- (nullable AUTRoute *)addFanOutRoute:(NSArray<NSString *> *)routeComponents withHandler:(AUTRouteWithoutContextHandlerBlock)handler;
+
+/// An optional handler that is invoked in place of failing with the
+/// AUTRoutingErrorCodeNoMatchFound code when none of the receiver's routes
+/// match, consuming all of the remaining components.
+///
+/// A single fallback can land users on the nearest valid screen in place of
+/// registering routes for every path that should lead there. Invoked on the
+/// router's handler scheduler, like route handlers. Defaults to nil.
+@property (atomic, copy, nullable) AUTRoutesFallbackHandlerBlock fallbackHandler;
 
-/// The collection of routes that the receiver represents.
+/// Whether the receiver compares components against its most frequently hit
+/// routes first.
+///
+/// When enabled, only routes whose first path component can match are
+/// compared, in order of their hit counts, and matching stops once none of the
+/// remaining routes are long enough to be selected. The order is periodically
+/// updated from the hit counts. Enabling this never changes which route is
+/// selected for a set of components, as ties between equally long matches are
+/// broken by specificity rather than by the order of comparison.
+///
+/// Defaults to NO.
+@property (atomic) BOOL ordersRoutesByHits;
+
+/// A snapshot of the usage counters of each of the receiver's routes, in
+/// descending order of hits.
+///
+/// Counters are kept for the lifetime of each route and are incremented with
+/// minimal overhead while routing, so are always available.
+@property (readonly, atomic, copy) NSArray<AUTRouteStatistics *> *routeStatistics;
+
+/// Like routeStatistics, but as an array of the JSON objects of each snapshot,
+/// e.g. to be uploaded to find routes that are never hit.
+///
+/// @see -[AUTRouteStatistics JSONObject]
+@property (readonly, atomic, copy) NSArray<NSDictionary<NSString *, id> *> *routeStatisticsJSONObject;
+
+/// Resets the usage counters of each of the receiver's routes to zero.
+- (void)resetRouteStatistics;
+
+/// An estimate of the memory used by the receiver's routes.
+@property (readonly, atomic) AUTRoutesMemoryUsage *memoryUsage;
+
+/// Discards the caches of the receiver and its routes, which are rebuilt as
+/// they are needed. Idempotent routes invoke their handlers again the next
+/// time that they are matched. The routes of the static route table are not
+/// purged, as they are shared with any other AUTRoutes that use the table.
+- (void)purgeCaches;
+
+/// Whether the receiver purges its caches when the system signals memory
+/// pressure.
+///
+/// Defaults to NO.
+@property (atomic) BOOL purgesCachesOnMemoryPressure;
+
+/// The collection of routes that the receiver represents, including those of
+/// its static route table.
 @property (readonly, atomic, copy) NSSet<AUTRoute *> *routes;
 
+/// Returns the receiver's route with the provided identifier, or nil if there
+/// is none.
+///
+/// @see AUTRoute.identifier
+- (nullable AUTRoute *)routeWithIdentifier:(NSString *)identifier;
+
+/// Like -[AUTRoute URLWithScheme:parameters:], but generates the URL from the
+/// receiver's route with the provided identifier.
+///
+/// @return The URL, or nil if the receiver has no route with the identifier or
+///         the parameters are missing values that the route requires.
+- (nullable NSURL *)URLForRouteWithIdentifier:(NSString *)identifier scheme:(NSString *)scheme parameters:(NSDictionary<NSString *, NSString *> *)parameters;
+
 /// Removes the provided route from the receiver.
 - (void)removeRoute:(AUTRoute *)route;
 
@@ -65,6 +207,42 @@ NS_ASSUME_NONNULL_BEGIN
 ///         the receiver.
 - (nullable AUTRoute *)addRoute:(AUTRoute *)route;
 
+/// Like -addRoute:, but the route is removed from the receiver automatically
+/// when the provided owner deallocates, e.g. a view model that is recycled.
+///
+/// The owner is not retained. The route's handler should not retain the owner
+/// either, or the owner will never deallocate. If the route is removed and an
+/// equal route is added in its place, the owner deallocating does not remove
+/// the replacement.
+///
+/// @return The added route, or else nil if the route has already been added to
+///         the receiver, in which case it is not associated with the owner.
+- (nullable AUTRoute *)addRoute:(AUTRoute *)route owner:(id)owner;
+
+/// Adds the provided routes to the receiver as a single batch.
+///
+/// Routes that have already been added to the receiver, or that appear more
+/// than once in the provided array, are rejected. The receiver's routes are
+/// updated atomically, so routing that is in progress observes either all or
+/// none of the added routes.
+///
+/// @return The routes that were rejected as duplicates, in the order that they
+///         were provided.
+- (NSArray<AUTRoute *> *)addRoutes:(NSArray<AUTRoute *> *)routes;
+
+/// Replaces all of the receiver's routes with the provided routes as a single
+/// batch. The routes of the receiver's static route table are kept, and
+/// provided routes equal to one of them are rejected.
+///
+/// Routes that appear more than once in the provided array are rejected, with
+/// the first occurrence being kept. The receiver's routes are updated
+/// atomically, so routing that is in progress observes either the previous or
+/// the new routes, never a mix of both.
+///
+/// @return The routes that were rejected as duplicates, in the order that they
+///         were provided.
+- (NSArray<AUTRoute *> *)replaceRoutes:(NSArray<AUTRoute *> *)routes;
+
 @end
 
 NS_ASSUME_NONNULL_END
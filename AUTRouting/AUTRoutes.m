@@ -6,15 +6,287 @@
 //  Copyright © 2015 Automatic Labs. All rights reserved.
 //
 
+@import ObjectiveC.runtime;
+
+#import <stdatomic.h>
+
 #import "AUTExtObjC.h"
+#import "AUTRoutable.h"
 #import "AUTRoute_Private.h"
+#import "AUTRouteStatistics.h"
+#import "AUTRoutesMemoryUsage.h"
 #import "AUTRoutingErrors.h"
+#import "AUTRoutingRequest.h"
+#import "AUTRoutingTime.h"
 
 #import "AUTRoutes_Private.h"
+#import "AUTStaticRouteTable_Private.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@implementation AUTRoutes
+/// Adds each of the provided routes to the given set in a single pass,
+/// returning those that were already present in it or in the static routes.
+static NSArray<AUTRoute *> *AddUniqueRoutes(NSArray<AUTRoute *> *routes, NSMutableSet<AUTRoute *> *uniqueRoutes, NSSet<AUTRoute *> * _Nullable staticRoutes) {
+    AUTCAssertNotNil(routes, uniqueRoutes);
+
+    let rejectedRoutes = [NSMutableArray<AUTRoute *> array];
+
+    for (AUTRoute *route in routes) {
+        if ([uniqueRoutes containsObject:route] || [staticRoutes containsObject:route]) {
+            [rejectedRoutes addObject:route];
+        } else {
+            [uniqueRoutes addObject:route];
+        }
+    }
+
+    return [rejectedRoutes copy];
+}
+
+/// The number of hits after which the order that routes are compared in is
+/// updated from their hit counts.
+static const uint32_t ReorderingHitInterval = 256;
+
+/// Returns whether a route that matched the provided number of components
+/// should be selected in place of the currently selected route.
+///
+/// Longer matches are preferred, followed by routes that declare query keys,
+/// routes that matched all of their path components, routes with more static
+/// components, and finally the route with the lowest identifier, so that the
+/// selected route never depends on the order in which routes are compared.
+static BOOL IsPreferredMatch(AUTRoute *route, NSInteger matchLength, AUTRoute * _Nullable selectedRoute, NSInteger selectedMatchLength) {
+    AUTCAssertNotNil(route);
+
+    if (matchLength != selectedMatchLength) return matchLength > selectedMatchLength;
+    if (matchLength == 0 || selectedRoute == nil) return NO;
+
+    if (route.hasQueryKeys != selectedRoute.hasQueryKeys) return route.hasQueryKeys;
+
+    let isComplete = (matchLength == (NSInteger)route.pathComponentCount);
+    let isSelectedComplete = (selectedMatchLength == (NSInteger)selectedRoute.pathComponentCount);
+    if (isComplete != isSelectedComplete) return isComplete;
+
+    if (route.staticComponentCount != selectedRoute.staticComponentCount) {
+        return route.staticComponentCount > selectedRoute.staticComponentCount;
+    }
+
+    return [route.identifier compare:AUTNotNil(selectedRoute).identifier] == NSOrderedAscending;
+}
+
+/// Routes that are compared against components in descending order of hits.
+@interface AUTRoutesMatchingGroup : NSObject
+
+/// @param owner The AUTRoutes whose counters the routes are ranked by.
+- (instancetype)initWithRoutes:(NSArray<AUTRoute *> *)routes owner:(AUTRoutes *)owner;
+
+/// The routes of the group, in descending order of their hit counts at the time
+/// that the group was created.
+@property (readonly, nonatomic, copy) NSArray<AUTRoute *> *routes;
+
+/// The maximum path component count of the routes from each index of routes to
+/// the end, which bounds the length of any match that remains to be found.
+@property (readonly, nonatomic) const NSUInteger *remainingMaximumLengths;
+
+@end
+
+@implementation AUTRoutesMatchingGroup {
+    NSUInteger *_remainingMaximumLengths;
+}
+
+- (instancetype)initWithRoutes:(NSArray<AUTRoute *> *)routes owner:(AUTRoutes *)owner {
+    AUTAssertNotNil(routes, owner);
+
+    self = [super init];
+
+    // Hit counts are captured up front, as they may be incremented while
+    // sorting.
+    let rankedRoutes = [NSMutableArray<RACTwoTuple<NSNumber *, AUTRoute *> *> arrayWithCapacity:routes.count];
+    for (AUTRoute *route in routes) {
+        [rankedRoutes addObject:RACTuplePack(@([owner countersForRoute:route].hitCount), route)];
+    }
+
+    [rankedRoutes sortUsingComparator:^(RACTwoTuple<NSNumber *, AUTRoute *> *tuple1, RACTwoTuple<NSNumber *, AUTRoute *> *tuple2) {
+        let comparison = [tuple2.first compare:tuple1.first];
+        if (comparison != NSOrderedSame) return comparison;
+
+        return [tuple1.second.identifier compare:tuple2.second.identifier];
+    }];
+
+    _routes = [[rankedRoutes.rac_sequence map:^(RACTwoTuple<NSNumber *, AUTRoute *> *tuple) {
+        return tuple.second;
+    }] array];
+
+    _remainingMaximumLengths = malloc(MAX(routes.count, 1) * sizeof(NSUInteger));
+
+    NSUInteger maximumLength = 0;
+    for (NSInteger index = (NSInteger)_routes.count - 1; index >= 0; index--) {
+        maximumLength = MAX(maximumLength, _routes[(NSUInteger)index].pathComponentCount);
+        _remainingMaximumLengths[index] = maximumLength;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_remainingMaximumLengths);
+}
+
+- (const NSUInteger *)remainingMaximumLengths {
+    return _remainingMaximumLengths;
+}
+
+@end
+
+/// The routes of an AUTRoutes grouped by their first path component, which
+/// allows only the routes that can match a set of components to be compared.
+@interface AUTRoutesMatchingOrder : NSObject
+
+/// @param staticRoutes Routes that are grouped along with the provided routes.
+///
+/// @param owner The AUTRoutes whose counters the routes are ranked by.
+- (instancetype)initWithRoutes:(NSSet<AUTRoute *> *)routes staticRoutes:(NSArray<AUTRoute *> *)staticRoutes owner:(AUTRoutes *)owner;
+
+/// The routes that the receiver was created from, excluding the static routes.
+@property (readonly, nonatomic) NSSet<AUTRoute *> *routes;
+
+/// The number of routes that the receiver groups.
+@property (readonly, nonatomic) NSUInteger count;
+
+/// The routes whose first path component is dynamic, which can match any
+/// components.
+@property (readonly, nonatomic) AUTRoutesMatchingGroup *dynamicGroup;
+
+/// Returns the routes whose first path component has the provided identifier,
+/// or nil if there are none.
+- (nullable AUTRoutesMatchingGroup *)groupForSegmentID:(AUTRouteSegmentID)segmentID;
+
+@end
+
+@implementation AUTRoutesMatchingOrder {
+    NSDictionary<NSNumber *, AUTRoutesMatchingGroup *> *_groups;
+}
+
+- (instancetype)initWithRoutes:(NSSet<AUTRoute *> *)routes staticRoutes:(NSArray<AUTRoute *> *)staticRoutes owner:(AUTRoutes *)owner {
+    AUTAssertNotNil(routes, staticRoutes, owner);
+
+    self = [super init];
+
+    let routesBySegmentID = [NSMutableDictionary<NSNumber *, NSMutableArray<AUTRoute *> *> dictionary];
+    let dynamicRoutes = [NSMutableArray<AUTRoute *> array];
+
+    for (AUTRoute *route in [staticRoutes arrayByAddingObjectsFromArray:routes.allObjects]) {
+        let segmentID = route.firstSegmentID;
+
+        if (segmentID == AUTRouteSegmentIDDynamic) {
+            [dynamicRoutes addObject:route];
+            continue;
+        }
+
+        var segmentRoutes = routesBySegmentID[@(segmentID)];
+        if (segmentRoutes == nil) {
+            segmentRoutes = [NSMutableArray array];
+            routesBySegmentID[@(segmentID)] = segmentRoutes;
+        }
+
+        [segmentRoutes addObject:route];
+    }
+
+    let groups = [NSMutableDictionary<NSNumber *, AUTRoutesMatchingGroup *> dictionaryWithCapacity:routesBySegmentID.count];
+    [routesBySegmentID enumerateKeysAndObjectsUsingBlock:^(NSNumber *segmentID, NSMutableArray<AUTRoute *> *segmentRoutes, BOOL *stop) {
+        groups[segmentID] = [[AUTRoutesMatchingGroup alloc] initWithRoutes:segmentRoutes owner:owner];
+    }];
+
+    _routes = routes;
+    _count = staticRoutes.count + routes.count;
+    _groups = [groups copy];
+    _dynamicGroup = [[AUTRoutesMatchingGroup alloc] initWithRoutes:dynamicRoutes owner:owner];
+
+    return self;
+}
+
+- (nullable AUTRoutesMatchingGroup *)groupForSegmentID:(AUTRouteSegmentID)segmentID {
+    return _groups[@(segmentID)];
+}
+
+@end
+
+/// Removes a route from an AUTRoutes when the owner that it is associated with
+/// deallocates.
+@interface AUTRoutesRouteOwnership : NSObject
+
+- (instancetype)initWithRoutes:(AUTRoutes *)routes route:(AUTRoute *)route;
+
+@end
+
+@interface AUTRoutes ()
+
+/// Removes the provided route from the receiver, unless an equal route has
+/// been added in its place.
+- (void)removeRouteIfIdentical:(AUTRoute *)route;
+
+@end
+
+@implementation AUTRoutesRouteOwnership {
+    __weak AUTRoutes *_routes;
+    AUTRoute *_route;
+}
+
+- (instancetype)initWithRoutes:(AUTRoutes *)routes route:(AUTRoute *)route {
+    AUTAssertNotNil(routes, route);
+
+    self = [super init];
+
+    _routes = routes;
+    _route = route;
+
+    return self;
+}
+
+- (void)dealloc {
+    [_routes removeRouteIfIdentical:_route];
+}
+
+@end
+
+/// The routes that purge their caches on memory pressure. Also guards the
+/// memory pressure source.
+static NSHashTable<AUTRoutes *> *MemoryPressureRoutes(void) {
+    static NSHashTable<AUTRoutes *> *routes;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        routes = [NSHashTable weakObjectsHashTable];
+    });
+
+    return routes;
+}
+
+/// The routes of each routable class's route template, keyed by class.
+static NSMapTable<Class, AUTRoutes *> *TemplateRoutes(void) {
+    static NSMapTable<Class, AUTRoutes *> *routes;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        routes = [NSMapTable strongToStrongObjectsMapTable];
+    });
+
+    return routes;
+}
+
+@implementation AUTRoutes {
+    /// The order that routes are compared in when ordering routes by hits, or
+    /// nil if it has not yet been created. Guarded by self.
+    AUTRoutesMatchingOrder * _Nullable _matchingOrder;
+
+    /// The number of hits since the matching order was last updated.
+    _Atomic(uint32_t) _hitsSinceReordering;
+
+    /// The routes that are removed when their owner deallocates. Guarded by
+    /// self.
+    NSHashTable<AUTRoute *> *_ownedRoutes;
+
+    /// The counters of each of the routes of the static route table, in the
+    /// same order as the table's routes, as the routes themselves are shared
+    /// with every other AUTRoutes that uses the table.
+    NSArray<AUTRouteCounters *> *_staticRouteCounters;
+}
 
 #pragma mark - Lifecycle
 
@@ -22,6 +294,26 @@ NS_ASSUME_NONNULL_BEGIN
     self = [super init];
 
     _routes = [NSMutableSet set];
+    _ownedRoutes = [NSHashTable weakObjectsHashTable];
+    _staticRouteCounters = @[];
+
+    return self;
+}
+
+- (instancetype)initWithStaticRouteTable:(AUTStaticRouteTable *)staticRouteTable target:(nullable id)target {
+    AUTAssertNotNil(staticRouteTable);
+
+    self = [self init];
+
+    _staticRouteTable = staticRouteTable;
+    _target = target;
+
+    let staticRouteCounters = [NSMutableArray<AUTRouteCounters *> arrayWithCapacity:staticRouteTable.count];
+    for (NSUInteger index = 0; index < staticRouteTable.count; index++) {
+        [staticRouteCounters addObject:[[AUTRouteCounters alloc] init]];
+    }
+
+    _staticRouteCounters = [staticRouteCounters copy];
 
     return self;
 }
@@ -38,6 +330,33 @@ NS_ASSUME_NONNULL_BEGIN
     return [self addRoute:route];
 }
 
+- (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents owner:(id)owner withHandler:(AUTRouteWithoutContextHandlerBlock)handler {
+    AUTAssertNotNil(routeComponents, owner, handler);
+
+    let route = [[AUTRoute alloc] initWithComponents:routeComponents handler:handler];
+
+    return [self addRoute:route owner:owner];
+}
+
+- (nullable AUTRoute *)addIdempotentRoute:(NSArray<NSString *> *)routeComponents cachedRoutableLifetime:(NSTimeInterval)lifetime withHandler:(AUTRouteWithoutContextHandlerBlock)handler {
+    AUTAssertNotNil(routeComponents, handler);
+
+    let route = [[AUTRoute alloc] initWithComponents:routeComponents handler:handler];
+    route.idempotent = YES;
+    route.cachedRoutableLifetime = lifetime;
+
+    return [self addRoute:route];
+}
+
+- (nullable AUTRoute *)addFanOutRoute:(NSArray<NSString *> *)routeComponents withHandler:(AUTRouteWithoutContextHandlerBlock)handler {
+    AUTAssertNotNil(routeComponents, handler);
+
+    let route = [[AUTRoute alloc] initWithComponents:routeComponents handler:handler];
+    route.fansOut = YES;
+
+    return [self addRoute:route];
+}
+
 - (nullable AUTRoute *)addRoute:(NSArray<NSString *> *)routeComponents withSignal:(RACSignal<id<AUTRoutable>> *)signal {
     AUTAssertNotNil(routeComponents, signal);
     
@@ -59,70 +378,487 @@ NS_ASSUME_NONNULL_BEGIN
 
     let route = [[AUTRoute alloc] initWithComponents:routeComponents contextClass:contextClass handler:handler];
 
-    return [self addRoute:route];
+    // Looked up and added in a single step, so that concurrent registrations
+    // of the same components merge their handlers rather than racing to add
+    // the route.
+    @synchronized(self) {
+        let existingRoute = [self.staticRouteTable.routeSet member:route] ?: [self->_routes member:route];
+        if (existingRoute != nil) {
+            return [existingRoute addHandler:handler forContextClass:contextClass] ? existingRoute : nil;
+        }
+
+        return [self addRoute:route];
+    }
+}
+
+- (nullable AUTRoute *)routeWithIdentifier:(NSString *)identifier {
+    AUTAssertNotNil(identifier);
+
+    // Routes equal to those of the static route table are rejected, so an
+    // identifier is never in both.
+    let staticRoute = self.staticRouteTable.routesByIdentifier[identifier];
+    if (staticRoute != nil) return staticRoute;
+
+    @synchronized(self) {
+        if (self->_publishedRoutesByIdentifier == nil) {
+            let routes = self.dynamicRoutes;
+            let routesByIdentifier = [NSMutableDictionary<NSString *, AUTRoute *> dictionaryWithCapacity:routes.count];
+
+            for (AUTRoute *route in routes) {
+                routesByIdentifier[route.identifier] = route;
+            }
+
+            self->_publishedRoutesByIdentifier = [routesByIdentifier copy];
+        }
+
+        return self->_publishedRoutesByIdentifier[identifier];
+    }
+}
+
+- (nullable NSURL *)URLForRouteWithIdentifier:(NSString *)identifier scheme:(NSString *)scheme parameters:(NSDictionary<NSString *, NSString *> *)parameters {
+    AUTAssertNotNil(identifier, scheme, parameters);
+
+    let route = [self routeWithIdentifier:identifier];
+    if (route == nil) return nil;
+
+    return [route URLWithScheme:scheme parameters:parameters];
 }
 
 - (void)removeRoute:(AUTRoute *)route {
     AUTAssertNotNil(route);
 
     @synchronized(self) {
+        if (![self->_routes containsObject:route]) return;
+
         [self->_routes removeObject:route];
+        self->_publishedRoutes = nil;
+        self->_publishedRoutesByIdentifier = nil;
     }
 }
 
 - (nullable AUTRoute *)addRoute:(AUTRoute *)route {
     AUTAssertNotNil(route);
 
+    let rejectedRoutes = [self addRoutes:@[ route ]];
+
+    return (rejectedRoutes.count == 0) ? route : nil;
+}
+
+- (nullable AUTRoute *)addRoute:(AUTRoute *)route owner:(id)owner {
+    AUTAssertNotNil(route, owner);
+
+    if ([self addRoute:route] == nil) return nil;
+
     @synchronized(self) {
-        if ([self->_routes containsObject:route]) return nil;
-        [self->_routes addObject:route];
-        return route;
+        [self->_ownedRoutes addObject:route];
     }
+
+    // Keyed by the ownership itself, so that an owner can own any number of
+    // routes.
+    let ownership = [[AUTRoutesRouteOwnership alloc] initWithRoutes:self route:route];
+    objc_setAssociatedObject(owner, (__bridge const void *)ownership, ownership, OBJC_ASSOCIATION_RETAIN);
+
+    return route;
+}
+
+- (NSArray<AUTRoute *> *)addRoutes:(NSArray<AUTRoute *> *)routes {
+    AUTAssertNotNil(routes);
+
+    let staticRoutes = self.staticRouteTable.routeSet;
+
+    // Only the provided routes are visited, so adding routes one at a time
+    // stays linear overall. Readers observe the whole batch at once, as they
+    // are handed a snapshot that is only recreated after the lock is released.
+    @synchronized(self) {
+        let rejectedRoutes = AddUniqueRoutes(routes, self->_routes, staticRoutes);
+
+        if (rejectedRoutes.count < routes.count) {
+            self->_publishedRoutes = nil;
+            self->_publishedRoutesByIdentifier = nil;
+        }
+
+        return rejectedRoutes;
+    }
+}
+
+- (NSArray<AUTRoute *> *)replaceRoutes:(NSArray<AUTRoute *> *)routes {
+    AUTAssertNotNil(routes);
+
+    NSMutableSet<AUTRoute *> *updatedRoutes = [NSMutableSet setWithCapacity:routes.count];
+    let rejectedRoutes = AddUniqueRoutes(routes, updatedRoutes, self.staticRouteTable.routeSet);
+
+    @synchronized(self) {
+        self->_routes = updatedRoutes;
+        self->_publishedRoutes = nil;
+        self->_publishedRoutesByIdentifier = nil;
+    }
+
+    return rejectedRoutes;
 }
 
 - (NSSet<AUTRoute *> *)routes {
+    let dynamicRoutes = self.dynamicRoutes;
+
+    let staticRouteTable = self.staticRouteTable;
+    if (staticRouteTable == nil) return dynamicRoutes;
+
+    return [staticRouteTable.routeSet setByAddingObjectsFromSet:dynamicRoutes];
+}
+
+- (NSArray<AUTRouteStatistics *> *)routeStatistics {
+    let statistics = [NSMutableArray<AUTRouteStatistics *> arrayWithCapacity:self.routes.count];
+
+    for (AUTRoute *route in self.routes) {
+        let counters = [self countersForRoute:route];
+        [statistics addObject:[[AUTRouteStatistics alloc] initWithRouteIdentifier:route.identifier hitCount:counters.hitCount nearMissCount:counters.nearMissCount handlerDuration:counters.handlerDuration]];
+    }
+
+    [statistics sortUsingComparator:^(AUTRouteStatistics *statistics1, AUTRouteStatistics *statistics2) {
+        if (statistics1.hitCount != statistics2.hitCount) {
+            return (statistics1.hitCount > statistics2.hitCount) ? NSOrderedAscending : NSOrderedDescending;
+        }
+
+        return [statistics1.routeIdentifier compare:statistics2.routeIdentifier];
+    }];
+
+    return [statistics copy];
+}
+
+- (NSArray<NSDictionary<NSString *, id> *> *)routeStatisticsJSONObject {
+    return [[self.routeStatistics.rac_sequence map:^(AUTRouteStatistics *statistics) {
+        return statistics.JSONObject;
+    }] array];
+}
+
+- (void)resetRouteStatistics {
+    for (AUTRoute *route in self.routes) {
+        [[self countersForRoute:route] reset];
+    }
+}
+
+- (AUTRoutesMemoryUsage *)memoryUsage {
+    let routes = self.routes;
+
+    NSUInteger ownedRouteCount = 0;
+    NSUInteger segmentByteCount = 0;
+    NSUInteger cacheByteCount = 0;
+
+    @synchronized(self) {
+        for (AUTRoute *route in routes) {
+            if ([self->_ownedRoutes containsObject:route]) ownedRouteCount++;
+        }
+
+        cacheByteCount += self->_matchingOrder.count * (sizeof(id) + sizeof(NSUInteger));
+    }
+
+    for (AUTRoute *route in routes) {
+        segmentByteCount += route.segmentByteCount;
+        cacheByteCount += route.cacheByteCount;
+    }
+
+    return [[AUTRoutesMemoryUsage alloc] initWithRouteCount:routes.count ownedRouteCount:ownedRouteCount segmentByteCount:segmentByteCount cacheByteCount:cacheByteCount];
+}
+
+- (void)purgeCaches {
     @synchronized(self) {
-        return [self->_routes copy];
+        self->_matchingOrder = nil;
+    }
+
+    // The routes of the static route table are shared with every other
+    // AUTRoutes that uses it, so are left for them.
+    for (AUTRoute *route in self.dynamicRoutes) {
+        [route purgeCaches];
+    }
+}
+
+- (BOOL)purgesCachesOnMemoryPressure {
+    let routes = MemoryPressureRoutes();
+
+    @synchronized(routes) {
+        return [routes containsObject:self];
+    }
+}
+
+- (void)setPurgesCachesOnMemoryPressure:(BOOL)purgesCachesOnMemoryPressure {
+    let routes = MemoryPressureRoutes();
+
+    @synchronized(routes) {
+        if (purgesCachesOnMemoryPressure) {
+            [routes addObject:self];
+        } else {
+            [routes removeObject:self];
+        }
+    }
+
+    if (purgesCachesOnMemoryPressure) {
+        [AUTRoutes observeMemoryPressure];
     }
 }
 
 #pragma mark - Private
 
-- (nullable AUTRoute *)matchingRouteForComponents:(NSArray<NSString *> *)components {
+/// Begins purging the caches of routes that purge their caches on memory
+/// pressure whenever the system signals memory pressure.
++ (void)observeMemoryPressure {
+    static dispatch_source_t source;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+
+        dispatch_source_set_event_handler(source, ^{
+            [AUTRoutes handleMemoryPressure];
+        });
+
+        dispatch_resume(source);
+    });
+}
+
++ (void)handleMemoryPressure {
+    let memoryPressureRoutes = MemoryPressureRoutes();
+
+    NSArray<AUTRoutes *> *purgedRoutes;
+    @synchronized(memoryPressureRoutes) {
+        purgedRoutes = memoryPressureRoutes.allObjects;
+    }
+
+    for (AUTRoutes *routes in purgedRoutes) {
+        [routes purgeCaches];
+    }
+}
+
++ (AUTRoutes *)templateRoutesForRoutableClass:(Class<AUTTemplateRoutable>)routableClass {
+    AUTAssertNotNil(routableClass);
+
+    let templateRoutes = TemplateRoutes();
+
+    @synchronized (templateRoutes) {
+        var routes = [templateRoutes objectForKey:routableClass];
+
+        if (routes == nil) {
+            let routeTemplate = [routableClass routeTemplate];
+            routes = [[AUTRoutes alloc] initWithStaticRouteTable:routeTemplate target:nil];
+            [templateRoutes setObject:routes forKey:routableClass];
+        }
+
+        return AUTNotNil(routes);
+    }
+}
+
+- (void)removeRouteIfIdentical:(AUTRoute *)route {
+    AUTAssertNotNil(route);
+
+    @synchronized(self) {
+        if ([self->_routes member:route] != route) return;
+
+        [self->_routes removeObject:route];
+        self->_publishedRoutes = nil;
+        self->_publishedRoutesByIdentifier = nil;
+    }
+}
+
+- (NSSet<AUTRoute *> *)dynamicRoutes {
+    @synchronized(self) {
+        if (self->_publishedRoutes == nil) {
+            self->_publishedRoutes = [self->_routes copy];
+        }
+
+        return AUTNotNil(self->_publishedRoutes);
+    }
+}
+
+/// Returns the route that most specifically matches the provided components,
+/// or nil if none match.
+///
+/// Each component is looked up in the segment table once, after which
+/// candidate routes are compared against the interned identifiers.
+///
+/// @param matchLength If non-NULL, populated with the length of the match.
+/// @param request The request whose query parameters routes that declare query
+///        keys are matched against, or nil to match such routes regardless of
+///        their query keys. Near misses are only counted if non-nil and the
+///        request counts them.
+- (nullable AUTRoute *)matchingRouteForComponents:(NSArray<NSString *> *)components request:(nullable AUTRoutingRequest *)request matchLength:(nullable NSInteger *)matchLength {
     AUTAssertNotNil(components);
     NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
 
+    let count = components.count;
+    AUTRouteSegmentID stackSegmentIDs[AUTRouteSegmentStackBufferCount];
+    AUTRouteSegmentID *segmentIDs = (count <= AUTRouteSegmentStackBufferCount) ? stackSegmentIDs : malloc(count * sizeof(AUTRouteSegmentID));
+    AUTRouteSegmentLookup(components, segmentIDs);
+
+    let route = [self matchingRouteForSegmentIDs:segmentIDs count:count request:request matchLength:matchLength];
+
+    if (segmentIDs != stackSegmentIDs) free(segmentIDs);
+
+    return route;
+}
+
+- (nullable AUTRoute *)matchingRouteForSegmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count request:(nullable AUTRoutingRequest *)request matchLength:(nullable NSInteger *)matchLength {
+    NSParameterAssert(segmentIDs != NULL);
+    NSAssert(count > 0, @"Unable to match zero segments, this is programmer error");
+
     NSInteger maximumMatchLength = 0;
     AUTRoute *matchingRoute;
 
-    for (AUTRoute *route in self.routes) {
-        NSInteger matchLength = [route matchingCountWithComponents:components];
+    if (self.ordersRoutesByHits) {
+        let matchingOrder = self.matchingOrder;
 
-        // Select the route with most specific match, for cases like:
-        // `vehicles/:id` vs. `vehicles/:id/timeline`.
-        if (matchLength > maximumMatchLength) {
-            maximumMatchLength = matchLength;
-            matchingRoute = route;
+        // Only routes that begin with the first component, or with a dynamic
+        // component, can match any of the components.
+        let segmentGroup = [matchingOrder groupForSegmentID:segmentIDs[0]];
+        if (segmentGroup != nil) {
+            [self matchGroup:AUTNotNil(segmentGroup) segmentIDs:segmentIDs count:count request:request matchingRoute:&matchingRoute matchLength:&maximumMatchLength];
         }
+
+        [self matchGroup:matchingOrder.dynamicGroup segmentIDs:segmentIDs count:count request:request matchingRoute:&matchingRoute matchLength:&maximumMatchLength];
+    } else {
+        for (AUTRoute *route in self.staticRouteTable.routes) {
+            [self matchRoute:route segmentIDs:segmentIDs count:count request:request matchingRoute:&matchingRoute matchLength:&maximumMatchLength];
+        }
+
+        for (AUTRoute *route in self.dynamicRoutes) {
+            [self matchRoute:route segmentIDs:segmentIDs count:count request:request matchingRoute:&matchingRoute matchLength:&maximumMatchLength];
+        }
+    }
+
+    if (matchLength != NULL) {
+        *matchLength = maximumMatchLength;
     }
 
     return matchingRoute;
 }
 
-- (BOOL)canHandleComponents:(NSArray<NSString *> *)components {
-    AUTAssertNotNil(components);
+/// Compares the provided route against the given components, replacing the
+/// matching route if the route is preferred over it.
+- (void)matchRoute:(AUTRoute *)route segmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count request:(nullable AUTRoutingRequest *)request matchingRoute:(AUTRoute * _Nullable __strong *)matchingRoute matchLength:(NSInteger *)matchLength {
+    let routeMatchLength = [route matchingCountWithSegmentIDs:segmentIDs count:count];
+
+    if (request.countsNearMisses && routeMatchLength > 0 && routeMatchLength < (NSInteger)route.pathComponentCount) {
+        [[self countersForRoute:route] recordNearMiss];
+    }
+
+    // Select the route with most specific match, for cases like:
+    // `vehicles/:id` vs. `vehicles/:id/timeline`, preferring routes that
+    // declare query keys for cases like `inbox?tab` vs. `inbox`.
+    if (!IsPreferredMatch(route, routeMatchLength, *matchingRoute, *matchLength)) return;
+
+    // Query parameters are only parsed once a route that declares query keys
+    // would otherwise be selected.
+    if (route.hasQueryKeys && request != nil && ![route matchesQueryParameters:AUTNotNil(request).queryParameters]) {
+        if (request.countsNearMisses) {
+            [[self countersForRoute:route] recordNearMiss];
+        }
+
+        return;
+    }
+
+    *matchLength = routeMatchLength;
+    *matchingRoute = route;
+}
+
+/// Like -matchRoute:segmentIDs:count:request:matchingRoute:matchLength:, but
+/// for each of the routes of the provided group in order, stopping once none
+/// of the remaining routes are long enough to be preferred over the matching
+/// route.
+- (void)matchGroup:(AUTRoutesMatchingGroup *)group segmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count request:(nullable AUTRoutingRequest *)request matchingRoute:(AUTRoute * _Nullable __strong *)matchingRoute matchLength:(NSInteger *)matchLength {
+    let routes = group.routes;
+    let remainingMaximumLengths = group.remainingMaximumLengths;
+
+    for (NSUInteger index = 0; index < routes.count; index++) {
+        if (*matchLength > (NSInteger)remainingMaximumLengths[index]) return;
 
-    return ([self matchingRouteForComponents:components] != nil);
+        [self matchRoute:routes[index] segmentIDs:segmentIDs count:count request:request matchingRoute:matchingRoute matchLength:matchLength];
+    }
+}
+
+/// The order that routes are compared in when ordering routes by hits, which
+/// is recreated when routes change or once enough routes have been hit.
+- (AUTRoutesMatchingOrder *)matchingOrder {
+    let routes = self.dynamicRoutes;
+    let staticRoutes = self.staticRouteTable.routes ?: @[];
+
+    @synchronized(self) {
+        let isStale = atomic_load_explicit(&_hitsSinceReordering, memory_order_relaxed) >= ReorderingHitInterval;
+
+        if (_matchingOrder == nil || _matchingOrder.routes != routes || isStale) {
+            _matchingOrder = [[AUTRoutesMatchingOrder alloc] initWithRoutes:routes staticRoutes:staticRoutes owner:self];
+            atomic_store_explicit(&_hitsSinceReordering, 0, memory_order_relaxed);
+        }
+
+        return AUTNotNil(_matchingOrder);
+    }
+}
+
+- (AUTRouteCounters *)countersForRoute:(AUTRoute *)route {
+    AUTAssertNotNil(route);
+
+    let staticRouteTable = self.staticRouteTable;
+    if (staticRouteTable == nil || route.staticRouteTable != staticRouteTable) return route.counters;
+
+    return _staticRouteCounters[route.staticRouteIndex];
+}
+
+- (BOOL)canHandleComponents:(NSArray<NSString *> *)components URL:(NSURL *)url {
+    AUTAssertNotNil(components, url);
+
+    // Matched against the URL's query like routing would be, but without
+    // affecting the statistics of the routes.
+    let request = [[AUTRoutingRequest alloc] initWithURL:url context:nil interceptors:nil];
+    request.countsNearMisses = NO;
+
+    return ([self matchingRouteForComponents:components request:request matchLength:NULL] != nil);
 }
 
 - (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components context:(nullable id)context URL:(NSURL *)url {
     AUTAssertNotNil(components, url);
     NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
 
+    let request = [[AUTRoutingRequest alloc] initWithURL:url context:context interceptors:nil];
+
+    return [self handleComponents:components request:request];
+}
+
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request {
+    return [self handleComponents:components request:request target:nil];
+}
+
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request target:(nullable id)target {
+    AUTAssertNotNil(components, request);
+    NSAssert(components.count > 0, @"Unable to handle zero components, this is programmer error");
+
     return [RACSignal defer:^ RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> * {
-        let route = [self matchingRouteForComponents:components];
+        let url = request.URL;
+        id context = request.context;
+
+        let tracing = request.tracing;
+        let matchStartTime = tracing ? AUTRoutingMonotonicTime() : 0;
+
+        NSInteger matchLength = 0;
+        let route = [self matchingRouteForComponents:components request:request matchLength:&matchLength];
+
+        if (tracing) {
+            [request recordMatchOfRoute:route matchLength:matchLength duration:AUTRoutingMonotonicTime() - matchStartTime];
+        }
 
         if (route == nil) {
+            let fallbackHandler = self.fallbackHandler;
+            if (fallbackHandler != nil) {
+                let handling = [[[RACSignal
+                    defer:^{
+                        return AUTNotNil(fallbackHandler)(components, context, url);
+                    }]
+                    take:1]
+                    map:^(id<AUTRoutable> routable) {
+                        return RACTuplePack(routable, @[]);
+                    }];
+
+                // Like route handlers, fallback handlers are moved off of the
+                // matching scheduler.
+                if (request.handlerScheduler == nil) return handling;
+
+                return [handling subscribeOn:AUTNotNil(request.handlerScheduler)];
+            }
+
             NSMutableDictionary<NSString *, id> *userInfo = [NSMutableDictionary dictionaryWithDictionary:@{
                 NSLocalizedDescriptionKey: @"Routing failed",
                 NSLocalizedFailureReasonErrorKey: @"No matching route found",
@@ -139,7 +875,46 @@ NS_ASSUME_NONNULL_BEGIN
             return [RACSignal error:error];
         }
 
-        return [route handleComponents:components context:context URL:url];
+        let counters = [self countersForRoute:route];
+        [counters recordHit];
+        atomic_fetch_add_explicit(&self->_hitsSinceReordering, 1, memory_order_relaxed);
+
+        request.hopFansOut = route.fansOut;
+
+        let queryParameters = route.hasQueryKeys ? request.queryParameters : nil;
+        let parameters = [route parametersForComponents:components matchLength:matchLength queryParameters:queryParameters];
+        let remainingComponents = [components subarrayWithRange:NSMakeRange((NSUInteger)matchLength, components.count - (NSUInteger)matchLength)];
+
+        if (request.snapshotting) {
+            [request recordSnapshotHopOfRoute:route parameters:parameters componentCount:components.count matchLength:matchLength];
+        }
+
+        // Handler time is recorded on disposal, which covers both the
+        // handler's signal terminating and routing being cancelled.
+        let handling = [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+            let handlerStartTime = AUTRoutingMonotonicTime();
+
+            var handling = [route handleParameters:parameters remainingComponents:remainingComponents context:context URL:url target:target ?: self.target];
+
+            // Take just the first next routable in case the handler's signal
+            // has a longer lifecycle, unless each is a branch.
+            if (!route.fansOut) {
+                handling = [handling take:1];
+            }
+
+            let disposable = [handling subscribe:subscriber];
+
+            return [RACDisposable disposableWithBlock:^{
+                [disposable dispose];
+                [counters recordHandlerDuration:AUTRoutingMonotonicTime() - handlerStartTime];
+            }];
+        }];
+
+        // Handlers are only rescheduled when matching is performed off of the
+        // thread that routing was started from.
+        if (request.handlerScheduler == nil) return handling;
+
+        return [handling subscribeOn:AUTNotNil(route.scheduler ?: request.handlerScheduler)];
     }];
 }
 
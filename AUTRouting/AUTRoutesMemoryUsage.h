@@ -0,0 +1,38 @@
+//
+//  AUTRoutesMemoryUsage.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An estimate of the memory used by the routes of an AUTRoutes.
+///
+/// @see -[AUTRoutes memoryUsage]
+@interface AUTRoutesMemoryUsage : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRouteCount:(NSUInteger)routeCount ownedRouteCount:(NSUInteger)ownedRouteCount segmentByteCount:(NSUInteger)segmentByteCount cacheByteCount:(NSUInteger)cacheByteCount NS_DESIGNATED_INITIALIZER;
+
+/// The number of routes.
+@property (readonly, nonatomic) NSUInteger routeCount;
+
+/// The number of routes that are removed when their owner deallocates.
+@property (readonly, nonatomic) NSUInteger ownedRouteCount;
+
+/// The bytes used to store the patterns of the routes. Segment strings are
+/// interned and shared between routes, but are counted for each route that
+/// uses them.
+@property (readonly, nonatomic) NSUInteger segmentByteCount;
+
+/// The bytes used by caches that can be purged, e.g. the next routables of
+/// idempotent routes and compiled URL templates.
+@property (readonly, nonatomic) NSUInteger cacheByteCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
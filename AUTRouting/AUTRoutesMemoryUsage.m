@@ -0,0 +1,39 @@
+//
+//  AUTRoutesMemoryUsage.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRoutesMemoryUsage.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTRoutesMemoryUsage
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRouteCount:(NSUInteger)routeCount ownedRouteCount:(NSUInteger)ownedRouteCount segmentByteCount:(NSUInteger)segmentByteCount cacheByteCount:(NSUInteger)cacheByteCount {
+    self = [super init];
+
+    _routeCount = routeCount;
+    _ownedRouteCount = ownedRouteCount;
+    _segmentByteCount = segmentByteCount;
+    _cacheByteCount = cacheByteCount;
+
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> routes: %lu (%lu owned), segment bytes: %lu, cache bytes: %lu", self.class, self, (unsigned long)self.routeCount, (unsigned long)self.ownedRouteCount, (unsigned long)self.segmentByteCount, (unsigned long)self.cacheByteCount];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
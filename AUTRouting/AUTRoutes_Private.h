@@ -7,21 +7,44 @@
 //
 
 #import <AUTRouting/AUTRoutes.h>
+#import <AUTRouting/AUTRouteSegments.h>
 
 @class AUTRoute;
+@class AUTRouteCounters;
+@class AUTRoutingRequest;
+@protocol AUTTemplateRoutable;
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface AUTRoutes () {
-    /// The registered routes.
+    /// The registered routes, excluding those of the static route table.
+    ///
+    /// Mutated in place, so that adding a single route is constant time.
+    /// Readers are handed an immutable snapshot of it instead.
     ///
     /// Should only be accessed when synchronized on self.
     NSMutableSet<AUTRoute *> *_routes;
+
+    /// An immutable copy of the registered routes, or nil if they have changed
+    /// since it was last created. Recreated lazily, so that a batch of updates
+    /// is only ever copied once.
+    ///
+    /// Should only be accessed when synchronized on self.
+    NSSet<AUTRoute *> * _Nullable _publishedRoutes;
+
+    /// The published routes keyed by identifier, or nil if they have changed
+    /// since it was last created. Recreated lazily alongside the published
+    /// routes, so that looking up a route by identifier is constant time.
+    ///
+    /// Should only be accessed when synchronized on self.
+    NSDictionary<NSString *, AUTRoute *> * _Nullable _publishedRoutesByIdentifier;
 }
 
 /// Returns YES if the receiver has a matching route pattern to handle the given
-/// route components, NO otherwise. Does not trigger any side effects.
-- (BOOL)canHandleComponents:(NSArray<NSString *> *)components;
+/// route components of the provided URL, NO otherwise. Routes that declare
+/// query keys are matched against the URL's query, as they are when routing.
+/// Does not trigger any side effects.
+- (BOOL)canHandleComponents:(NSArray<NSString *> *)components URL:(NSURL *)url;
 
 /// Forwards the given components to the handler for the matching route pattern,
 /// else errors if no handler could be found to handle the components.
@@ -38,6 +61,59 @@ NS_ASSUME_NONNULL_BEGIN
 ///         and the array is the remaining components to handle.
 - (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components context:(nullable id)context URL:(NSURL *)url;
 
+/// Like -handleComponents:context:URL:, but as a hop of the provided routing
+/// request, recording the match if the request is being traced.
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request;
+
+/// Like -handleComponents:request:, but invokes static handlers with the
+/// provided target, or with the receiver's target if nil.
+- (RACSignal<RACTwoTuple<id<AUTRoutable>, NSArray<NSString *> *> *> *)handleComponents:(NSArray<NSString *> *)components request:(AUTRoutingRequest *)request target:(nullable id)target;
+
+/// Returns the routes of the route template of the provided template routable
+/// class, which are created the first time that they are requested and then
+/// shared by all instances of the class.
+///
+/// The routes have no target, so should be handled with an instance of the
+/// class as the target.
++ (AUTRoutes *)templateRoutesForRoutableClass:(Class<AUTTemplateRoutable>)routableClass;
+
+/// Purges the caches of each of the routes that purge their caches on memory
+/// pressure, as is done when the system signals memory pressure.
++ (void)handleMemoryPressure;
+
+/// Returns the route that most specifically matches the provided components,
+/// or nil if none match.
+///
+/// @param request The request whose query parameters routes that declare query
+///        keys are matched against, or nil to match such routes regardless of
+///        their query keys. Near misses are only counted if non-nil and the
+///        request counts them.
+///
+/// @param matchLength If non-NULL, populated with the length of the match.
+- (nullable AUTRoute *)matchingRouteForComponents:(NSArray<NSString *> *)components request:(nullable AUTRoutingRequest *)request matchLength:(nullable NSInteger *)matchLength;
+
+/// Like -matchingRouteForComponents:request:matchLength:, but with the
+/// identifiers of components that have already been looked up in the segment
+/// table, so that they can be matched against any number of routes.
+///
+/// @param count The number of segment identifiers, which must be nonzero.
+- (nullable AUTRoute *)matchingRouteForSegmentIDs:(const AUTRouteSegmentID *)segmentIDs count:(NSUInteger)count request:(nullable AUTRoutingRequest *)request matchLength:(nullable NSInteger *)matchLength;
+
+/// The routes that have been added to the receiver, excluding those of its
+/// static route table.
+///
+/// A new set is published on the first read after each update, so the identity
+/// of the set changes whenever the routes do.
+@property (readonly, atomic) NSSet<AUTRoute *> *dynamicRoutes;
+
+/// Returns the usage counters of the provided route when matched by the
+/// receiver.
+///
+/// The routes of the receiver's static route table are counted separately by
+/// each AUTRoutes that uses the table, so their counters only reflect routing
+/// through the receiver.
+- (AUTRouteCounters *)countersForRoute:(AUTRoute *)route;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -14,11 +14,22 @@ FOUNDATION_EXPORT double AUTRoutingVersionNumber;
 //! Project version string for AUTRouting.
 FOUNDATION_EXPORT const unsigned char AUTRoutingVersionString[];
 
+#import <AUTRouting/AUTDeferredRouter.h>
 #import <AUTRouting/AUTRoute.h>
+#import <AUTRouting/AUTRouteStatistics.h>
 #import <AUTRouting/AUTRouter.h>
 #import <AUTRouting/AUTRoutes.h>
+#import <AUTRouting/AUTRoutesMemoryUsage.h>
+#import <AUTRouting/AUTRoutingBranch.h>
 #import <AUTRouting/AUTRoutingErrors.h>
+#import <AUTRouting/AUTRoutingInterceptor.h>
+#import <AUTRouting/AUTRoutingIntrospection.h>
+#import <AUTRouting/AUTRoutingQueue.h>
+#import <AUTRouting/AUTRoutingRestorationContext.h>
+#import <AUTRouting/AUTRoutingSnapshot.h>
+#import <AUTRouting/AUTRoutingTrace.h>
 #import <AUTRouting/AUTRoutable.h>
+#import <AUTRouting/AUTStaticRouteTable.h>
 #import <AUTRouting/AUTLog.h>
 #import <AUTRouting/NSURL+AUTRouting.h>
 #import <AUTRouting/RACCommand+AUTRoutes.h>
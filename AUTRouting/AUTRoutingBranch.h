@@ -0,0 +1,35 @@
+//
+//  AUTRoutingBranch.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+@protocol AUTRoutable;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A routable that is sent by the handler of a fan-out route in order to route
+/// it with its own slice of components, in place of the components that remain
+/// after the route.
+///
+/// @see AUTRoute.fansOut
+@interface AUTRoutingBranch : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param components The components that the routable handles, or an empty
+///        array if routing should end at the routable.
+- (instancetype)initWithRoutable:(id<AUTRoutable>)routable components:(NSArray<NSString *> *)components NS_DESIGNATED_INITIALIZER;
+
+/// The routable that the branch routes to.
+@property (readonly, nonatomic) id<AUTRoutable> routable;
+
+/// The components that the routable handles.
+@property (readonly, nonatomic, copy) NSArray<NSString *> *components;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,39 @@
+//
+//  AUTRoutingBranch.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRoutingBranch.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTRoutingBranch
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRoutable:(id<AUTRoutable>)routable components:(NSArray<NSString *> *)components {
+    AUTAssertNotNil(routable, components);
+
+    self = [super init];
+
+    _routable = routable;
+    _components = [components copy];
+
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> %@ components: %@", self.class, self, self.routable, [self.components componentsJoinedByString:@"/"]];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -28,6 +28,8 @@ typedef NS_ENUM(NSInteger, AUTRoutingErrorCode) {
     /// - AUTRoutingErrorURLKey
     /// - AUTRoutingErrorContextKey (if a context was provided to routing)
     /// - AUTRoutingErrorRemainingComponentsKey
+    /// - AUTRoutingErrorRootFailureReasonsKey (if a router with more than one
+    ///   root could not match any of its roots)
     AUTRoutingErrorCodeNoMatchFound,
 
     /// No route path components could be extracted from the given URL.
@@ -37,7 +39,8 @@ typedef NS_ENUM(NSInteger, AUTRoutingErrorCode) {
     AUTRoutingErrorCodeInvalidURL,
 
     /// Routing could not continue due to a non-routable object being sent in
-    /// place of a routable.
+    /// place of a routable, i.e. one that conforms to neither AUTRoutable nor
+    /// AUTTemplateRoutable.
     ///
     /// Its user info has the following keys populated:
     /// - AUTRoutingErrorURLKey
@@ -57,6 +60,32 @@ typedef NS_ENUM(NSInteger, AUTRoutingErrorCode) {
     /// - AUTRoutingErrorRemainingComponentsKey
     /// - NSUnderlyingErrorKey
     AUTRoutingErrorCodeRouteHandlerFailed,
+
+    /// Routing did not finish before a deadline configured on the router
+    /// elapsed.
+    ///
+    /// Its user info has the following keys populated:
+    /// - AUTRoutingErrorURLKey
+    /// - AUTRoutingErrorContextKey (if a context was provided to routing)
+    /// - AUTRoutingErrorRemainingComponentsKey (if a single hop exceeded its
+    ///   deadline)
+    AUTRoutingErrorCodeTimedOut,
+
+    /// Routing was cancelled in favor of routing to a more recent URL.
+    ///
+    /// Its user info has the following keys populated:
+    /// - AUTRoutingErrorURLKey
+    /// - AUTRoutingErrorContextKey (if a context was provided to routing)
+    AUTRoutingErrorCodeCancelled,
+
+    /// Routing was dropped by a routing queue that was at capacity, either
+    /// before it was enqueued or to make room for a higher priority URL, or by
+    /// a deferred router to make room for a more recent URL.
+    ///
+    /// Its user info has the following keys populated:
+    /// - AUTRoutingErrorURLKey
+    /// - AUTRoutingErrorContextKey (if a context was provided to routing)
+    AUTRoutingErrorCodeDropped,
 };
 
 /// The URL that was being routed to when a routing failure occurred.
@@ -68,4 +97,8 @@ extern NSString * const AUTRoutingErrorContextKey;
 /// The remaining components of routing to when a routing failure occurred.
 extern NSString * const AUTRoutingErrorRemainingComponentsKey;
 
+/// An array of the reason that each root of a router failed to match, in the
+/// order of the router's roots.
+extern NSString * const AUTRoutingErrorRootFailureReasonsKey;
+
 NS_ASSUME_NONNULL_END
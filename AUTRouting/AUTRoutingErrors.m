@@ -18,4 +18,6 @@ NSString * const AUTRoutingErrorContextKey = @"AUTRoutingErrorContextKey";
 
 NSString * const AUTRoutingErrorRemainingComponentsKey = @"AUTRoutingErrorRemainingComponentsKey";
 
+NSString * const AUTRoutingErrorRootFailureReasonsKey = @"AUTRoutingErrorRootFailureReasonsKey";
+
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,61 @@
+//
+//  AUTRoutingInterceptor.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+@class AUTRouter;
+@class AUTRoutes;
+@protocol AUTRoutable;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Describes an object that is invoked synchronously by an AUTRouter as it
+/// routes, allowing routing to be rewritten, short-circuited or annotated
+/// without wrapping the router's handleURL command.
+///
+/// Each of the methods is passed an annotations dictionary that is shared
+/// between every interceptor invocation while routing to a single URL, which
+/// interceptors may use to annotate routing (e.g. to record when routing
+/// began for analytics).
+///
+/// @see -[AUTRouter interceptors]
+@protocol AUTRoutingInterceptor <NSObject>
+
+@optional
+
+/// Invoked before the provided URL is tokenized into routing components.
+///
+/// @return The URL that should be routed to in place of the provided URL (e.g.
+///         a rewritten legacy URL), or the provided URL to leave it unchanged.
+///         Returning nil stops routing: if error is populated, routing errors
+///         with it, otherwise routing finishes successfully without routing to
+///         the URL.
+- (nullable NSURL *)router:(AUTRouter *)router willTokenizeURL:(NSURL *)url context:(nullable id)context annotations:(NSMutableDictionary<NSString *, id> *)annotations error:(NSError **)error;
+
+/// Invoked before the provided components are handled by the given routes.
+///
+/// @return The components that should be handled in place of the provided
+///         components, or the provided components to leave them unchanged.
+///         Returning nil or an empty array stops routing: if error is
+///         populated, routing errors with it, otherwise routing finishes
+///         successfully without handling the components.
+- (nullable NSArray<NSString *> *)router:(AUTRouter *)router willHandleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes context:(nullable id)context URL:(NSURL *)url annotations:(NSMutableDictionary<NSString *, id> *)annotations error:(NSError **)error;
+
+/// Invoked after the provided components have been handled by the given
+/// routes.
+///
+/// @param routable The next routable that the route handler sent, or nil if
+///        the route handler completed without sending one.
+///
+/// @param remainingComponents The components that remain to be handled by the
+///        next routable, or nil if the route handler completed without sending
+///        one.
+- (void)router:(AUTRouter *)router didHandleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes nextRoutable:(nullable id<AUTRoutable>)routable remainingComponents:(nullable NSArray<NSString *> *)remainingComponents context:(nullable id)context URL:(NSURL *)url annotations:(NSMutableDictionary<NSString *, id> *)annotations;
+
+@end
+
+NS_ASSUME_NONNULL_END
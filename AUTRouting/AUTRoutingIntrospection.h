@@ -0,0 +1,67 @@
+//
+//  AUTRoutingIntrospection.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+#import <AUTRouting/AUTRouter.h>
+#import <AUTRouting/AUTRoutes.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface AUTRoutes (AUTRoutingIntrospection)
+
+/// A description of the structure that the receiver's routes are matched with,
+/// which can be serialized with NSJSONSerialization.
+///
+/// Routes are arranged into a tree of nodes, where each edge consumes a single
+/// path component, either a static segment or a token that matches any
+/// segment. All of the token components at the same position share a single
+/// edge, as they are indistinguishable when matching. Contains the following
+/// keys:
+/// - "nodes": Each node, with its "id", "depth", "fanout" (the number of edges
+///   from it), "routes" (the identifiers of the routes that end at it) and
+///   "ambiguous" (whether it has both static and token edges, such that a
+///   component may match more than one branch).
+/// - "edges": Each edge, with the "from" and "to" node ids, and a "kind" of
+///   either "static" with its "segment", or "token" with its token "keys".
+/// - "routes": Each route, with its "id", the "node" that it ends at, its
+///   "required_query_keys", "optional_query_keys", "context_classes", its
+///   usage counters as in -[AUTRouteStatistics JSONObject], and "shadowed_by"
+///   if another route is always selected in its place.
+/// - "orders_routes_by_hits": Whether the receiver orders routes by hits.
+@property (readonly, atomic, copy) NSDictionary<NSString *, id> *introspectionJSONObject;
+
+/// Like introspectionJSONObject, but as a Graphviz DOT graph.
+///
+/// Static edges are solid and token edges are dashed. Nodes that routes end at
+/// are labeled with the routes' identifiers and hit counts, ambiguous nodes are
+/// orange, and shadowed routes are red.
+@property (readonly, atomic, copy) NSString *introspectionDOTString;
+
+@end
+
+@interface AUTRouter (AUTRoutingIntrospection)
+
+/// A description of the receiver's configuration and its root routes, which
+/// can be serialized with NSJSONSerialization. Contains the following keys:
+/// - "root": The introspectionJSONObject of the root routes, or of the highest
+///   priority root if the receiver has more than one.
+/// - "roots": If the receiver has more than one root, the
+///   introspectionJSONObject of each root in order of priority.
+/// - "settings": The receiver's routing settings.
+/// - "traced_routes": If the receiver has a trace recorder, each of the routes
+///   that were matched in the recorded traces, including those of routables
+///   beyond the root, with their "route" identifier, number of "matches", and
+///   cumulative "match_duration" and "handler_duration".
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, id> *introspectionJSONObject;
+
+/// The introspectionDOTString of the receiver's root routes.
+@property (readonly, nonatomic, copy) NSString *introspectionDOTString;
+
+@end
+
+NS_ASSUME_NONNULL_END
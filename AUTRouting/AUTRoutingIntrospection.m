@@ -0,0 +1,454 @@
+//
+//  AUTRoutingIntrospection.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+#import "AUTRoute_Private.h"
+#import "AUTRouteStatistics.h"
+#import "AUTRouter_Private.h"
+#import "AUTRoutes_Private.h"
+#import "AUTRoutingTrace.h"
+
+#import "AUTRoutingIntrospection.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static let DynamicPrefix = @":";
+
+/// Returns the provided string as a quoted DOT identifier.
+static NSString *DOTQuotedString(NSString *string) {
+    AUTCAssertNotNil(string);
+
+    let escapedString = [[string
+        stringByReplacingOccurrencesOfString:@"\\" withString:@"\\\\"]
+        stringByReplacingOccurrencesOfString:@"\"" withString:@"\\\""];
+
+    return [NSString stringWithFormat:@"\"%@\"", escapedString];
+}
+
+/// A node of the tree that routes are arranged into for introspection.
+@interface AUTRoutingIntrospectionNode : NSObject
+
+- (instancetype)initWithDepth:(NSUInteger)depth;
+
+/// Assigned once the tree is complete, in breadth-first order.
+@property (nonatomic) NSUInteger identifier;
+
+@property (readonly, nonatomic) NSUInteger depth;
+
+/// The nodes reached by consuming each static segment.
+@property (readonly, nonatomic) NSMutableDictionary<NSString *, AUTRoutingIntrospectionNode *> *staticChildren;
+
+/// The node reached by consuming any segment, or nil if no route has a token
+/// component at this position.
+@property (nonatomic, nullable) AUTRoutingIntrospectionNode *tokenChild;
+
+/// The keys of the token components that share the edge to the token child.
+@property (readonly, nonatomic) NSMutableOrderedSet<NSString *> *tokenKeys;
+
+/// The routes whose path components end at the receiver.
+@property (readonly, nonatomic) NSMutableArray<AUTRoute *> *routes;
+
+/// The children of the receiver in a stable order, static children sorted by
+/// segment followed by the token child.
+@property (readonly, nonatomic) NSArray<AUTRoutingIntrospectionNode *> *orderedChildren;
+
+@end
+
+@implementation AUTRoutingIntrospectionNode
+
+- (instancetype)initWithDepth:(NSUInteger)depth {
+    self = [super init];
+
+    _depth = depth;
+    _staticChildren = [NSMutableDictionary dictionary];
+    _tokenKeys = [NSMutableOrderedSet orderedSet];
+    _routes = [NSMutableArray array];
+
+    return self;
+}
+
+- (NSArray<AUTRoutingIntrospectionNode *> *)orderedChildren {
+    let children = [NSMutableArray<AUTRoutingIntrospectionNode *> arrayWithCapacity:self.staticChildren.count + 1];
+
+    for (NSString *segment in [self.staticChildren.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        [children addObject:self.staticChildren[segment]];
+    }
+
+    if (self.tokenChild != nil) {
+        [children addObject:AUTNotNil(self.tokenChild)];
+    }
+
+    return [children copy];
+}
+
+@end
+
+/// The tree that the routes of an AUTRoutes are arranged into for
+/// introspection.
+@interface AUTRoutingIntrospectionTree : NSObject
+
+/// @param owner The AUTRoutes whose counters are described for each route.
+- (instancetype)initWithRoutes:(NSSet<AUTRoute *> *)routes owner:(AUTRoutes *)owner;
+
+/// The AUTRoutes whose counters are described for each route.
+@property (readonly, nonatomic) AUTRoutes *owner;
+
+/// The nodes of the tree in breadth-first order, indexed by identifier.
+@property (readonly, nonatomic, copy) NSArray<AUTRoutingIntrospectionNode *> *nodes;
+
+/// The routes of the tree, sorted by identifier.
+@property (readonly, nonatomic, copy) NSArray<AUTRoute *> *routes;
+
+/// The node that each route ends at.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, AUTRoutingIntrospectionNode *> *nodesByRouteIdentifier;
+
+/// The route that is always selected in place of each shadowed route, keyed by
+/// the identifier of the shadowed route.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, AUTRoute *> *shadowingRoutes;
+
+/// @see -[AUTRoutes introspectionJSONObject]
+- (NSDictionary<NSString *, id> *)JSONObject;
+
+/// @see -[AUTRoutes introspectionDOTString]
+- (NSString *)DOTString;
+
+@end
+
+@implementation AUTRoutingIntrospectionTree
+
+- (instancetype)initWithRoutes:(NSSet<AUTRoute *> *)routes owner:(AUTRoutes *)owner {
+    AUTAssertNotNil(routes, owner);
+
+    self = [super init];
+
+    _owner = owner;
+
+    _routes = [routes.allObjects sortedArrayUsingComparator:^(AUTRoute *route1, AUTRoute *route2) {
+        return [route1.identifier compare:route2.identifier];
+    }];
+
+    let root = [[AUTRoutingIntrospectionNode alloc] initWithDepth:0];
+    let nodesByRouteIdentifier = [NSMutableDictionary<NSString *, AUTRoutingIntrospectionNode *> dictionaryWithCapacity:_routes.count];
+
+    for (AUTRoute *route in _routes) {
+        var node = root;
+
+        for (NSUInteger index = 0; index < route.pathComponentCount; index++) {
+            let component = route.components[index];
+
+            if ([component hasPrefix:DynamicPrefix]) {
+                if (node.tokenChild == nil) {
+                    node.tokenChild = [[AUTRoutingIntrospectionNode alloc] initWithDepth:node.depth + 1];
+                }
+
+                [node.tokenKeys addObject:[component substringFromIndex:DynamicPrefix.length]];
+                node = AUTNotNil(node.tokenChild);
+            } else {
+                var child = node.staticChildren[component];
+                if (child == nil) {
+                    child = [[AUTRoutingIntrospectionNode alloc] initWithDepth:node.depth + 1];
+                    node.staticChildren[component] = child;
+                }
+
+                node = AUTNotNil(child);
+            }
+        }
+
+        [node.routes addObject:route];
+        nodesByRouteIdentifier[route.identifier] = node;
+    }
+
+    _nodesByRouteIdentifier = [nodesByRouteIdentifier copy];
+
+    // Number the nodes breadth-first so that the output is stable.
+    let nodes = [NSMutableArray<AUTRoutingIntrospectionNode *> arrayWithObject:root];
+    for (NSUInteger index = 0; index < nodes.count; index++) {
+        nodes[index].identifier = index;
+        [nodes addObjectsFromArray:nodes[index].orderedChildren];
+    }
+
+    _nodes = [nodes copy];
+    _shadowingRoutes = [self shadowingRoutesForNodes:_nodes];
+
+    return self;
+}
+
+/// Routes that end at the same node match exactly the same path components,
+/// so among those that require the same query keys, only one is ever
+/// selected: one that declares query keys if any do, or else the one with the
+/// lowest identifier.
+- (NSDictionary<NSString *, AUTRoute *> *)shadowingRoutesForNodes:(NSArray<AUTRoutingIntrospectionNode *> *)nodes {
+    AUTAssertNotNil(nodes);
+
+    let shadowingRoutes = [NSMutableDictionary<NSString *, AUTRoute *> dictionary];
+
+    for (AUTRoutingIntrospectionNode *node in nodes) {
+        if (node.routes.count < 2) continue;
+
+        let routesByRequiredQueryKeys = [NSMutableDictionary<NSArray<NSString *> *, NSMutableArray<AUTRoute *> *> dictionary];
+
+        for (AUTRoute *route in node.routes) {
+            let requiredQueryKeys = [route.requiredQueryKeys ?: @[] sortedArrayUsingSelector:@selector(compare:)];
+
+            var routes = routesByRequiredQueryKeys[requiredQueryKeys];
+            if (routes == nil) {
+                routes = [NSMutableArray array];
+                routesByRequiredQueryKeys[requiredQueryKeys] = routes;
+            }
+
+            [routes addObject:route];
+        }
+
+        for (NSArray<AUTRoute *> *routes in routesByRequiredQueryKeys.allValues) {
+            // Routes are sorted by identifier, so the first route is the one
+            // with the lowest identifier.
+            var selectedRoute = routes.firstObject;
+            for (AUTRoute *route in routes) {
+                if (route.hasQueryKeys) {
+                    selectedRoute = route;
+                    break;
+                }
+            }
+
+            for (AUTRoute *route in routes) {
+                if (route == selectedRoute) continue;
+
+                shadowingRoutes[route.identifier] = selectedRoute;
+            }
+        }
+    }
+
+    return [shadowingRoutes copy];
+}
+
+- (NSDictionary<NSString *, id> *)JSONObject {
+    let nodes = [NSMutableArray<NSDictionary<NSString *, id> *> arrayWithCapacity:self.nodes.count];
+    let edges = [NSMutableArray<NSDictionary<NSString *, id> *> array];
+
+    for (AUTRoutingIntrospectionNode *node in self.nodes) {
+        let routeIdentifiers = [NSMutableArray<NSString *> arrayWithCapacity:node.routes.count];
+        for (AUTRoute *route in node.routes) {
+            [routeIdentifiers addObject:route.identifier];
+        }
+
+        [nodes addObject:@{
+            @"id": @(node.identifier),
+            @"depth": @(node.depth),
+            @"fanout": @(node.staticChildren.count + (node.tokenChild != nil ? 1 : 0)),
+            @"routes": routeIdentifiers,
+            @"ambiguous": @(node.staticChildren.count > 0 && node.tokenChild != nil),
+        }];
+
+        for (NSString *segment in [node.staticChildren.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+            [edges addObject:@{
+                @"from": @(node.identifier),
+                @"to": @(node.staticChildren[segment].identifier),
+                @"kind": @"static",
+                @"segment": segment,
+            }];
+        }
+
+        if (node.tokenChild != nil) {
+            [edges addObject:@{
+                @"from": @(node.identifier),
+                @"to": @(node.tokenChild.identifier),
+                @"kind": @"token",
+                @"keys": node.tokenKeys.array,
+            }];
+        }
+    }
+
+    let routes = [NSMutableArray<NSDictionary<NSString *, id> *> arrayWithCapacity:self.routes.count];
+
+    for (AUTRoute *route in self.routes) {
+        let contextClasses = [NSMutableArray<NSString *> arrayWithCapacity:route.contextClasses.count];
+        for (Class contextClass in route.contextClasses) {
+            [contextClasses addObject:NSStringFromClass(contextClass)];
+        }
+
+        let counters = [self.owner countersForRoute:route];
+        let statistics = [[AUTRouteStatistics alloc] initWithRouteIdentifier:route.identifier hitCount:counters.hitCount nearMissCount:counters.nearMissCount handlerDuration:counters.handlerDuration];
+
+        let routeObject = [NSMutableDictionary<NSString *, id> dictionaryWithDictionary:statistics.JSONObject];
+        [routeObject removeObjectForKey:@"route"];
+        [routeObject addEntriesFromDictionary:@{
+            @"id": route.identifier,
+            @"node": @(self.nodesByRouteIdentifier[route.identifier].identifier),
+            @"required_query_keys": route.requiredQueryKeys ?: @[],
+            @"optional_query_keys": route.optionalQueryKeys ?: @[],
+            @"context_classes": contextClasses,
+        }];
+
+        let shadowingRoute = self.shadowingRoutes[route.identifier];
+        if (shadowingRoute != nil) {
+            routeObject[@"shadowed_by"] = shadowingRoute.identifier;
+        }
+
+        [routes addObject:[routeObject copy]];
+    }
+
+    return @{
+        @"nodes": nodes,
+        @"edges": edges,
+        @"routes": routes,
+    };
+}
+
+- (NSString *)DOTString {
+    let lines = [NSMutableArray<NSString *> arrayWithObjects:
+        @"digraph routes {",
+        @"    rankdir=LR;",
+        @"    node [shape=circle, label=\"\"];",
+        nil];
+
+    for (AUTRoutingIntrospectionNode *node in self.nodes) {
+        let attributes = [NSMutableArray<NSString *> array];
+
+        if (node.routes.count > 0) {
+            let labels = [NSMutableArray<NSString *> arrayWithCapacity:node.routes.count];
+            var isShadowed = NO;
+
+            for (AUTRoute *route in node.routes) {
+                [labels addObject:[NSString stringWithFormat:@"%@ (%llu hits)", route.identifier, [self.owner countersForRoute:route].hitCount]];
+                isShadowed = isShadowed || (self.shadowingRoutes[route.identifier] != nil);
+            }
+
+            [attributes addObject:@"shape=box"];
+            [attributes addObject:[NSString stringWithFormat:@"label=%@", DOTQuotedString([labels componentsJoinedByString:@"\n"])]];
+
+            if (isShadowed) {
+                [attributes addObject:@"color=red"];
+            }
+        }
+
+        if (node.staticChildren.count > 0 && node.tokenChild != nil) {
+            [attributes addObject:@"style=filled, fillcolor=orange"];
+        }
+
+        if (attributes.count > 0) {
+            [lines addObject:[NSString stringWithFormat:@"    n%lu [%@];", (unsigned long)node.identifier, [attributes componentsJoinedByString:@", "]]];
+        }
+    }
+
+    for (AUTRoutingIntrospectionNode *node in self.nodes) {
+        for (NSString *segment in [node.staticChildren.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+            [lines addObject:[NSString stringWithFormat:@"    n%lu -> n%lu [label=%@];", (unsigned long)node.identifier, (unsigned long)node.staticChildren[segment].identifier, DOTQuotedString(segment)]];
+        }
+
+        if (node.tokenChild != nil) {
+            let label = [DynamicPrefix stringByAppendingString:[node.tokenKeys.array componentsJoinedByString:@" | :"]];
+            [lines addObject:[NSString stringWithFormat:@"    n%lu -> n%lu [label=%@, style=dashed];", (unsigned long)node.identifier, (unsigned long)node.tokenChild.identifier, DOTQuotedString(label)]];
+        }
+    }
+
+    [lines addObject:@"}"];
+
+    return [[lines componentsJoinedByString:@"\n"] stringByAppendingString:@"\n"];
+}
+
+@end
+
+@implementation AUTRoutes (AUTRoutingIntrospection)
+
+- (NSDictionary<NSString *, id> *)introspectionJSONObject {
+    let tree = [[AUTRoutingIntrospectionTree alloc] initWithRoutes:self.routes owner:self];
+
+    let JSONObject = [NSMutableDictionary<NSString *, id> dictionaryWithDictionary:[tree JSONObject]];
+    JSONObject[@"orders_routes_by_hits"] = @(self.ordersRoutesByHits);
+
+    return [JSONObject copy];
+}
+
+- (NSString *)introspectionDOTString {
+    let tree = [[AUTRoutingIntrospectionTree alloc] initWithRoutes:self.routes owner:self];
+
+    return [tree DOTString];
+}
+
+@end
+
+@implementation AUTRouter (AUTRoutingIntrospection)
+
+- (NSDictionary<NSString *, id> *)introspectionJSONObject {
+    let JSONObject = [NSMutableDictionary<NSString *, id> dictionaryWithDictionary:@{
+        @"root": self.routes.introspectionJSONObject,
+        @"settings": @{
+            @"concurrency_policy": @(self.concurrencyPolicy),
+            @"timeout": @(self.timeout),
+            @"hop_timeout": @(self.hopTimeout),
+            @"interceptor_count": @(self.interceptors.count),
+            @"matches_off_handler_scheduler": @(self.matchingScheduler != nil),
+            @"tokenizer_options": @(self.tokenizerOptions),
+            @"routes_as_deep_as_possible": @(self.routesAsDeepAsPossible),
+            @"coalescing_interval": @(self.coalescingInterval),
+        },
+    }];
+
+    let rootRoutes = self.rootRoutes;
+    if (rootRoutes.count > 1) {
+        JSONObject[@"roots"] = [[rootRoutes.rac_sequence map:^(AUTRoutes *routes) {
+            return routes.introspectionJSONObject;
+        }] array];
+    }
+
+    let traceRecorder = self.traceRecorder;
+    if (traceRecorder != nil) {
+        JSONObject[@"traced_routes"] = [self tracedRoutesJSONObjectWithRecords:traceRecorder.records];
+    }
+
+    return [JSONObject copy];
+}
+
+- (NSString *)introspectionDOTString {
+    return self.routes.introspectionDOTString;
+}
+
+/// Aggregates the hops of the provided records by the route that they matched.
+- (NSArray<NSDictionary<NSString *, id> *> *)tracedRoutesJSONObjectWithRecords:(NSArray<AUTRoutingTraceRecord *> *)records {
+    AUTAssertNotNil(records);
+
+    let matchCounts = [NSCountedSet<NSString *> set];
+    let matchDurations = [NSMutableDictionary<NSString *, NSNumber *> dictionary];
+    let handlerDurations = [NSMutableDictionary<NSString *, NSNumber *> dictionary];
+
+    for (AUTRoutingTraceRecord *record in records) {
+        for (AUTRoutingTraceHop *hop in record.hops) {
+            if (hop.routeComponents.count == 0) continue;
+
+            let identifier = [hop.routeComponents componentsJoinedByString:@"/"];
+
+            [matchCounts addObject:identifier];
+            matchDurations[identifier] = @(matchDurations[identifier].doubleValue + hop.matchDuration);
+            handlerDurations[identifier] = @(handlerDurations[identifier].doubleValue + hop.handlerDuration);
+        }
+    }
+
+    let identifiers = [matchCounts.allObjects sortedArrayUsingComparator:^(NSString *identifier1, NSString *identifier2) {
+        let count1 = [matchCounts countForObject:identifier1];
+        let count2 = [matchCounts countForObject:identifier2];
+        if (count1 != count2) return (count1 > count2) ? NSOrderedAscending : NSOrderedDescending;
+
+        return [identifier1 compare:identifier2];
+    }];
+
+    let tracedRoutes = [NSMutableArray<NSDictionary<NSString *, id> *> arrayWithCapacity:identifiers.count];
+
+    for (NSString *identifier in identifiers) {
+        [tracedRoutes addObject:@{
+            @"route": identifier,
+            @"matches": @([matchCounts countForObject:identifier]),
+            @"match_duration": AUTNotNil(matchDurations[identifier]),
+            @"handler_duration": AUTNotNil(handlerDurations[identifier]),
+        }];
+    }
+
+    return [tracedRoutes copy];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
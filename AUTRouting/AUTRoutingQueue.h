@@ -0,0 +1,101 @@
+//
+//  AUTRoutingQueue.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import ReactiveObjC;
+
+@class AUTRouter;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The priority class of a URL routed to through a routing queue. URLs with a
+/// higher priority are routed to before URLs with a lower priority.
+typedef NS_ENUM(NSInteger, AUTRoutingPriority) {
+    /// Low-value routing that the user is not waiting on, e.g. refreshing a
+    /// shortcut in the background.
+    AUTRoutingPriorityBackground,
+
+    /// The priority of URLs that are not provided with a priority.
+    AUTRoutingPriorityDefault,
+
+    /// Routing that the user is waiting on, e.g. a deeplink that was tapped.
+    AUTRoutingPriorityUserInitiated,
+};
+
+/// Determines how a routing queue handles a URL that is routed to while the
+/// queue is at its maximum depth.
+typedef NS_ENUM(NSInteger, AUTRoutingQueueOverflowPolicy) {
+    /// The more recent URL is dropped.
+    AUTRoutingQueueOverflowPolicyDropNewest,
+
+    /// The oldest of the lowest priority queued URLs is dropped to make room
+    /// for the more recent URL, unless the more recent URL has a lower priority
+    /// than every queued URL, in which case it is dropped instead.
+    AUTRoutingQueueOverflowPolicyReplaceLowestPriority,
+};
+
+/// Routes to URLs through a router in priority order, with a bounded number of
+/// concurrent routings and a bounded number of queued URLs.
+///
+/// URLs are routed to without the router's handleURL command, so its
+/// concurrency policy should be left as AUTRouterConcurrencyPolicyRejectNewest
+/// when routing concurrently through a queue.
+@interface AUTRoutingQueue : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param maxConcurrentRoutings The maximum number of URLs that are routed to
+///        at once. Must be greater than zero.
+///
+/// @param maxQueueDepth The maximum number of URLs that may wait to be routed
+///        to, or zero for no limit.
+- (instancetype)initWithRouter:(AUTRouter *)router maxConcurrentRoutings:(NSUInteger)maxConcurrentRoutings maxQueueDepth:(NSUInteger)maxQueueDepth NS_DESIGNATED_INITIALIZER;
+
+/// The router that URLs are routed to through.
+@property (readonly, nonatomic) AUTRouter *router;
+
+/// The maximum number of URLs that are routed to at once.
+@property (readonly, nonatomic) NSUInteger maxConcurrentRoutings;
+
+/// The maximum number of URLs that may wait to be routed to, or zero for no
+/// limit.
+@property (readonly, nonatomic) NSUInteger maxQueueDepth;
+
+/// How URLs that are routed to while the receiver is at its maximum queue
+/// depth are handled.
+///
+/// Defaults to AUTRoutingQueueOverflowPolicyDropNewest.
+@property (atomic) AUTRoutingQueueOverflowPolicy overflowPolicy;
+
+/// When executed with a tuple of the URL to handle, an optional context object
+/// and an optional NSNumber wrapping an AUTRoutingPriority, enqueues the URL
+/// to be routed to.
+///
+/// Its execution signals have the semantics of the execution signals of the
+/// router's handleURL command, sending the URL and context once routed to. If
+/// the URL is dropped due to the receiver being at its maximum queue depth,
+/// they error in the AUTRoutingErrorDomain domain with the
+/// AUTRoutingErrorCodeDropped code.
+///
+/// Allows concurrent execution.
+@property (readonly, nonatomic) RACCommand<RACThreeTuple<NSURL *, id, NSNumber *> *, RACTwoTuple<NSURL *, id> *> *handleURL;
+
+/// The number of URLs that are waiting to be routed to.
+@property (readonly, atomic) NSUInteger queueDepth;
+
+/// The largest queue depth that the receiver has reached.
+@property (readonly, atomic) NSUInteger peakQueueDepth;
+
+/// The number of URLs that are being routed to.
+@property (readonly, atomic) NSUInteger activeRoutingCount;
+
+/// The number of URLs that have been dropped due to the receiver being at its
+/// maximum queue depth.
+@property (readonly, atomic) NSUInteger droppedCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
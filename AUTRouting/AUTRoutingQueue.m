@@ -0,0 +1,248 @@
+//
+//  AUTRoutingQueue.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+#import "AUTLog.h"
+#import "AUTRouter_Private.h"
+#import "AUTRoutingErrors.h"
+
+#import "AUTRoutingQueue.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The number of AUTRoutingPriority classes.
+static const NSUInteger PriorityCount = AUTRoutingPriorityUserInitiated + 1;
+
+static NSError *DroppedError(NSURL *url, id _Nullable context) {
+    AUTCAssertNotNil(url);
+
+    let userInfo = (NSMutableDictionary<NSString *, id> *)[NSMutableDictionary dictionaryWithDictionary:@{
+        NSLocalizedDescriptionKey: @"Routing failed",
+        NSLocalizedFailureReasonErrorKey: @"The routing queue is at capacity",
+        AUTRoutingErrorURLKey: url,
+    }];
+
+    if (context != nil) {
+        userInfo[AUTRoutingErrorContextKey] = context;
+    }
+
+    return [NSError errorWithDomain:AUTRoutingErrorDomain code:AUTRoutingErrorCodeDropped userInfo:userInfo];
+}
+
+/// A URL that is waiting to be routed to.
+@interface AUTQueuedRouting : NSObject
+
+@property (readonly, nonatomic) NSURL *URL;
+
+@property (readonly, nonatomic, nullable) id context;
+
+@property (readonly, nonatomic) AUTRoutingPriority priority;
+
+/// Replays the outcome of routing to the URL.
+@property (readonly, nonatomic) RACReplaySubject<RACTwoTuple<NSURL *, id> *> *outcome;
+
+@end
+
+@implementation AUTQueuedRouting
+
+- (instancetype)initWithURL:(NSURL *)url context:(nullable id)context priority:(AUTRoutingPriority)priority {
+    self = [super init];
+
+    _URL = url;
+    _context = context;
+    _priority = priority;
+    _outcome = [RACReplaySubject subject];
+
+    return self;
+}
+
+@end
+
+@interface AUTRoutingQueue ()
+
+/// The queued routings of each priority class, indexed by priority, each in the
+/// order that they were enqueued. Also guards the receiver's metrics.
+@property (readonly, nonatomic) NSArray<NSMutableArray<AUTQueuedRouting *> *> *queuedRoutings;
+
+@end
+
+@implementation AUTRoutingQueue {
+    NSUInteger _queueDepth;
+    NSUInteger _peakQueueDepth;
+    NSUInteger _activeRoutingCount;
+    NSUInteger _droppedCount;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRouter:(AUTRouter *)router maxConcurrentRoutings:(NSUInteger)maxConcurrentRoutings maxQueueDepth:(NSUInteger)maxQueueDepth {
+    AUTAssertNotNil(router);
+    NSParameterAssert(maxConcurrentRoutings > 0);
+
+    self = [super init];
+
+    _router = router;
+    _maxConcurrentRoutings = maxConcurrentRoutings;
+    _maxQueueDepth = maxQueueDepth;
+
+    let queuedRoutings = [NSMutableArray<NSMutableArray<AUTQueuedRouting *> *> arrayWithCapacity:PriorityCount];
+    for (NSUInteger priority = 0; priority < PriorityCount; priority++) {
+        [queuedRoutings addObject:[NSMutableArray array]];
+    }
+    _queuedRoutings = [queuedRoutings copy];
+
+    _handleURL = [self createHandleURLCommand];
+
+    return self;
+}
+
+#pragma mark - AUTRoutingQueue
+
+- (RACCommand<RACThreeTuple<NSURL *, id, NSNumber *> *, RACTwoTuple<NSURL *, id> *> *)createHandleURLCommand {
+    @weakify(self);
+
+    let command = [[RACCommand alloc] initWithSignalBlock:^(RACThreeTuple<NSURL *, id, NSNumber *> *urlContextAndPriority) {
+        @strongifyOr(self) return [RACSignal empty];
+
+        let priorityNumber = (NSNumber *)urlContextAndPriority.third;
+        let priority = (priorityNumber != nil) ? (AUTRoutingPriority)priorityNumber.integerValue : AUTRoutingPriorityDefault;
+        NSAssert(priority >= 0 && (NSUInteger)priority < PriorityCount, @"Invalid routing priority %ld", (long)priority);
+
+        let routing = [[AUTQueuedRouting alloc] initWithURL:AUTNotNil(urlContextAndPriority.first) context:urlContextAndPriority.second priority:priority];
+
+        return [RACSignal defer:^{
+            [self enqueueRouting:routing];
+            return routing.outcome;
+        }];
+    }];
+
+    command.allowsConcurrentExecution = YES;
+
+    return command;
+}
+
+- (NSUInteger)queueDepth {
+    @synchronized (self.queuedRoutings) {
+        return _queueDepth;
+    }
+}
+
+- (NSUInteger)peakQueueDepth {
+    @synchronized (self.queuedRoutings) {
+        return _peakQueueDepth;
+    }
+}
+
+- (NSUInteger)activeRoutingCount {
+    @synchronized (self.queuedRoutings) {
+        return _activeRoutingCount;
+    }
+}
+
+- (NSUInteger)droppedCount {
+    @synchronized (self.queuedRoutings) {
+        return _droppedCount;
+    }
+}
+
+#pragma mark - Private
+
+- (void)enqueueRouting:(AUTQueuedRouting *)routing {
+    AUTAssertNotNil(routing);
+
+    AUTQueuedRouting * _Nullable droppedRouting;
+
+    @synchronized (self.queuedRoutings) {
+        if (self.maxQueueDepth > 0 && _queueDepth >= self.maxQueueDepth) {
+            droppedRouting = routing;
+
+            if (self.overflowPolicy == AUTRoutingQueueOverflowPolicyReplaceLowestPriority) {
+                let lowestPriorityRoutings = [self lowestPriorityQueuedRoutings];
+
+                if (lowestPriorityRoutings.firstObject.priority <= routing.priority) {
+                    droppedRouting = lowestPriorityRoutings.firstObject;
+                    [lowestPriorityRoutings removeObjectAtIndex:0];
+                    _queueDepth--;
+                }
+            }
+
+            _droppedCount++;
+        }
+
+        if (droppedRouting != routing) {
+            [self.queuedRoutings[routing.priority] addObject:routing];
+            _queueDepth++;
+            _peakQueueDepth = MAX(_peakQueueDepth, _queueDepth);
+        }
+    }
+
+    if (droppedRouting != nil) {
+        AUTLogRoutingInfo(@"%@ dropped routing to %@ at capacity", self, droppedRouting.URL);
+
+        [droppedRouting.outcome sendError:DroppedError(droppedRouting.URL, droppedRouting.context)];
+    }
+
+    [self startQueuedRoutings];
+}
+
+/// Returns the queued routings of the lowest priority class that has any, or
+/// nil if there are none. Must be called while synchronized on queuedRoutings.
+- (nullable NSMutableArray<AUTQueuedRouting *> *)lowestPriorityQueuedRoutings {
+    for (NSMutableArray<AUTQueuedRouting *> *routings in self.queuedRoutings) {
+        if (routings.count > 0) return routings;
+    }
+
+    return nil;
+}
+
+/// Dequeues the highest priority queued routing, or nil if there are none or
+/// the maximum number of concurrent routings are in progress.
+- (nullable AUTQueuedRouting *)dequeueRouting {
+    @synchronized (self.queuedRoutings) {
+        if (_activeRoutingCount >= self.maxConcurrentRoutings) return nil;
+
+        for (NSMutableArray<AUTQueuedRouting *> *routings in self.queuedRoutings.reverseObjectEnumerator) {
+            if (routings.count == 0) continue;
+
+            let routing = routings.firstObject;
+            [routings removeObjectAtIndex:0];
+
+            _queueDepth--;
+            _activeRoutingCount++;
+
+            return routing;
+        }
+
+        return nil;
+    }
+}
+
+- (void)startQueuedRoutings {
+    AUTQueuedRouting *routing;
+
+    while ((routing = [self dequeueRouting]) != nil) {
+        @weakify(self);
+
+        [[[self.router routingSignalForURL:routing.URL context:routing.context]
+            finally:^{
+                @strongifyOr(self) return;
+
+                @synchronized (self.queuedRoutings) {
+                    self->_activeRoutingCount--;
+                }
+
+                [self startQueuedRoutings];
+            }]
+            subscribe:routing.outcome];
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,139 @@
+//
+//  AUTRoutingRequest.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+@import ReactiveObjC;
+
+#import <AUTRouting/AUTRoutingInterceptor.h>
+
+@class AUTRoute;
+@class AUTRoutes;
+@class AUTRoutingSnapshotHop;
+@class AUTRoutingTraceHop;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The state of routing to a single URL, shared between each of the hops
+/// through the routing tree.
+///
+/// The hops that share a request are handled one after another. The branches
+/// of a fan-out route are handled concurrently, so each is handled with a
+/// request of its own.
+@interface AUTRoutingRequest : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param interceptors The interceptors that should be invoked while routing,
+///        normalized to nil if empty so that routing can skip interception
+///        with a single nil check.
+- (instancetype)initWithURL:(NSURL *)url context:(nullable id)context interceptors:(nullable NSArray<id<AUTRoutingInterceptor>> *)interceptors NS_DESIGNATED_INITIALIZER;
+
+/// Returns a request for a branch of the fan-out route that handled the
+/// receiver's current hop.
+///
+/// The branch continues from the receiver's hop count with its own hop state
+/// and a copy of the receiver's annotations, and shares the receiver's trace
+/// and unconsumed components. It is not snapshotting, as fan-out routes end
+/// snapshots.
+- (AUTRoutingRequest *)requestForBranch;
+
+/// The URL being routed to.
+///
+/// May be rewritten by interceptors before it is tokenized.
+@property (nonatomic) NSURL *URL;
+
+/// The parameters of the URL's query string, parsed lazily on first access
+/// and then shared between each of the hops.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, NSString *> *queryParameters;
+
+/// The optional context object that was provided with the URL.
+@property (readonly, nonatomic, nullable) id context;
+
+/// The interceptors to invoke while routing, or nil if there are none.
+@property (readonly, nonatomic, copy, nullable) NSArray<id<AUTRoutingInterceptor>> *interceptors;
+
+/// The scheduler that each hop is matched on, or nil if each hop is matched on
+/// the thread that the previous hop finished on.
+@property (nonatomic, nullable) RACScheduler *matchingScheduler;
+
+/// The scheduler that route handlers are invoked on unless overridden by their
+/// route, or nil if route handlers are invoked on the thread that matched them.
+@property (nonatomic, nullable) RACScheduler *handlerScheduler;
+
+/// Whether the routes that nearly match the components of each hop count the
+/// near miss in their statistics. Defaults to YES.
+@property (nonatomic) BOOL countsNearMisses;
+
+/// The number of hops through the routing tree that have begun.
+@property (nonatomic) NSUInteger hopCount;
+
+/// Whether the route that handled the current hop fans out, in which case each
+/// of its branches is handled with a request for the branch.
+@property (nonatomic) BOOL hopFansOut;
+
+/// The components that routing stopped short of when routing as deep as
+/// possible, or nil if routing consumed every component. Shared with each of
+/// the receiver's branches, so holds the components of the latest branch to
+/// stop short.
+@property (atomic, copy, nullable) NSArray<NSString *> *unconsumedComponents;
+
+/// The annotations shared between interceptors while routing, created lazily
+/// on first access.
+///
+/// Each branch has a copy of the annotations as of when it began, so that
+/// concurrent branches never mutate the same dictionary.
+@property (readonly, nonatomic) NSMutableDictionary<NSString *, id> *annotations;
+
+/// Whether the hops of the receiver are being traced.
+@property (readonly, nonatomic, getter=isTracing) BOOL tracing;
+
+/// The traced hops, or nil if the receiver is not being traced.
+///
+/// Each hop is added once its handler first responds. The hops of concurrent
+/// branches are interleaved in that order, as they are traced into the same
+/// list.
+@property (readonly, atomic, copy, nullable) NSArray<AUTRoutingTraceHop *> *traceHops;
+
+/// Begins tracing the hops of the receiver.
+- (void)beginTracing;
+
+/// Records the outcome of matching the components of the current hop. Has no
+/// effect if the receiver is not being traced.
+///
+/// @param route The route that was matched, or nil if none matched.
+- (void)recordMatchOfRoute:(nullable AUTRoute *)route matchLength:(NSInteger)matchLength duration:(NSTimeInterval)duration;
+
+/// Records the total duration of the current hop, including matching, and
+/// completes the hop. Has no effect if the receiver is not being traced or no
+/// match has been recorded for the current hop.
+- (void)recordHopDuration:(NSTimeInterval)duration;
+
+/// The root routes that handled the first hop, or nil if the first hop has not
+/// yet been matched.
+@property (nonatomic, nullable) AUTRoutes *rootRoutes;
+
+/// Whether the routes that handle each hop of the receiver are being recorded
+/// for a routing snapshot.
+@property (readonly, nonatomic, getter=isSnapshotting) BOOL snapshotting;
+
+/// The recorded snapshot hops, or nil if the receiver is not snapshotting.
+@property (readonly, nonatomic, copy, nullable) NSArray<AUTRoutingSnapshotHop *> *snapshotHops;
+
+/// Begins recording the routes that handle each hop of the receiver.
+///
+/// @param componentCount The number of components that the URL was tokenized
+///        into, from which the offset of each hop's components is found.
+- (void)beginSnapshottingWithComponentCount:(NSUInteger)componentCount;
+
+/// Records the route that handled the current hop, which had the provided
+/// number of components remaining. Has no effect if the receiver is not
+/// snapshotting, and ends snapshotting if the route fans out.
+- (void)recordSnapshotHopOfRoute:(AUTRoute *)route parameters:(NSDictionary<NSString *, NSString *> *)parameters componentCount:(NSUInteger)componentCount matchLength:(NSInteger)matchLength;
+
+@end
+
+NS_ASSUME_NONNULL_END
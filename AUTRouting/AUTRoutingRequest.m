@@ -0,0 +1,209 @@
+//
+//  AUTRoutingRequest.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+#import "AUTRoute.h"
+#import "AUTRoutingSnapshot.h"
+#import "AUTRoutingTrace.h"
+#import "NSURL+AUTRouting.h"
+
+#import "AUTRoutingRequest.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The state that a request shares with each of its branches.
+@interface AUTRoutingRequestSharedState : NSObject
+
+/// The hops that have been traced so far, or nil if not tracing. Guarded by
+/// the receiver.
+@property (nonatomic, nullable) NSMutableArray<AUTRoutingTraceHop *> *traceHops;
+
+/// The components that the latest branch to stop short stopped short of, or
+/// nil if none has. Guarded by the receiver.
+@property (nonatomic, copy, nullable) NSArray<NSString *> *unconsumedComponents;
+
+@end
+
+@implementation AUTRoutingRequestSharedState
+@end
+
+@implementation AUTRoutingRequest {
+    /// The state shared with the request that the receiver is a branch of, and
+    /// with each of the receiver's own branches.
+    AUTRoutingRequestSharedState *_sharedState;
+
+    /// The match recorded for the current hop, or nil if none has been
+    /// recorded since the previous hop completed.
+    NSArray<NSString *> * _Nullable _currentRouteComponents;
+    NSInteger _currentMatchLength;
+    NSTimeInterval _currentMatchDuration;
+
+    /// The hops that have been recorded for a snapshot so far, or nil if not
+    /// snapshotting.
+    NSMutableArray<AUTRoutingSnapshotHop *> * _Nullable _snapshotHops;
+    NSUInteger _componentCount;
+}
+
+@synthesize annotations = _annotations;
+@synthesize queryParameters = _queryParameters;
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithURL:(NSURL *)url context:(nullable id)context interceptors:(nullable NSArray<id<AUTRoutingInterceptor>> *)interceptors {
+    AUTAssertNotNil(url);
+
+    self = [super init];
+
+    _URL = url;
+    _context = context;
+    _interceptors = (interceptors.count > 0) ? [interceptors copy] : nil;
+    _countsNearMisses = YES;
+    _sharedState = [[AUTRoutingRequestSharedState alloc] init];
+
+    return self;
+}
+
+- (AUTRoutingRequest *)requestForBranch {
+    let request = [[AUTRoutingRequest alloc] initWithURL:self.URL context:self.context interceptors:self.interceptors];
+
+    request.matchingScheduler = self.matchingScheduler;
+    request.handlerScheduler = self.handlerScheduler;
+    request.countsNearMisses = self.countsNearMisses;
+    request.hopCount = self.hopCount;
+    request.rootRoutes = self.rootRoutes;
+
+    request->_queryParameters = _queryParameters;
+    request->_annotations = [_annotations mutableCopy];
+    request->_sharedState = _sharedState;
+
+    return request;
+}
+
+#pragma mark - AUTRoutingRequest
+
+- (void)setURL:(NSURL *)url {
+    AUTAssertNotNil(url);
+
+    _URL = url;
+    _queryParameters = nil;
+}
+
+- (NSDictionary<NSString *, NSString *> *)queryParameters {
+    if (_queryParameters == nil) {
+        _queryParameters = self.URL.aut_queryParameters;
+    }
+
+    return _queryParameters;
+}
+
+- (NSMutableDictionary<NSString *, id> *)annotations {
+    if (_annotations == nil) {
+        _annotations = [NSMutableDictionary dictionary];
+    }
+
+    return _annotations;
+}
+
+- (nullable NSArray<NSString *> *)unconsumedComponents {
+    @synchronized (_sharedState) {
+        return _sharedState.unconsumedComponents;
+    }
+}
+
+- (void)setUnconsumedComponents:(nullable NSArray<NSString *> *)unconsumedComponents {
+    @synchronized (_sharedState) {
+        _sharedState.unconsumedComponents = unconsumedComponents;
+    }
+}
+
+#pragma mark Tracing
+
+- (BOOL)isTracing {
+    @synchronized (_sharedState) {
+        return _sharedState.traceHops != nil;
+    }
+}
+
+- (nullable NSArray<AUTRoutingTraceHop *> *)traceHops {
+    @synchronized (_sharedState) {
+        return [_sharedState.traceHops copy];
+    }
+}
+
+- (void)beginTracing {
+    @synchronized (_sharedState) {
+        if (_sharedState.traceHops != nil) return;
+
+        _sharedState.traceHops = [NSMutableArray array];
+    }
+}
+
+- (void)recordMatchOfRoute:(nullable AUTRoute *)route matchLength:(NSInteger)matchLength duration:(NSTimeInterval)duration {
+    if (!self.tracing) return;
+
+    _currentRouteComponents = route.components ?: @[];
+    _currentMatchLength = matchLength;
+    _currentMatchDuration = duration;
+}
+
+- (void)recordHopDuration:(NSTimeInterval)duration {
+    if (_currentRouteComponents == nil) return;
+
+    let hop = [[AUTRoutingTraceHop alloc]
+        initWithRouteComponents:AUTNotNil(_currentRouteComponents)
+        matchLength:(NSUInteger)_currentMatchLength
+        matchDuration:_currentMatchDuration
+        handlerDuration:MAX(duration - _currentMatchDuration, 0)];
+
+    _currentRouteComponents = nil;
+
+    @synchronized (_sharedState) {
+        [_sharedState.traceHops addObject:hop];
+    }
+}
+
+#pragma mark Snapshotting
+
+- (BOOL)isSnapshotting {
+    return _snapshotHops != nil;
+}
+
+- (nullable NSArray<AUTRoutingSnapshotHop *> *)snapshotHops {
+    return [_snapshotHops copy];
+}
+
+- (void)beginSnapshottingWithComponentCount:(NSUInteger)componentCount {
+    if (_snapshotHops != nil) return;
+
+    _snapshotHops = [NSMutableArray array];
+    _componentCount = componentCount;
+}
+
+- (void)recordSnapshotHopOfRoute:(AUTRoute *)route parameters:(NSDictionary<NSString *, NSString *> *)parameters componentCount:(NSUInteger)componentCount matchLength:(NSInteger)matchLength {
+    AUTAssertNotNil(route, parameters);
+    NSAssert(componentCount <= _componentCount, @"Hops cannot have more components than the URL, this is programmer error");
+
+    if (_snapshotHops == nil) return;
+
+    // The branches of a fan-out route cannot be restored as a single chain.
+    if (route.fansOut) {
+        _snapshotHops = nil;
+        return;
+    }
+
+    [_snapshotHops addObject:[[AUTRoutingSnapshotHop alloc]
+        initWithRouteIdentifier:route.identifier
+        parameters:parameters
+        componentOffset:_componentCount - componentCount
+        matchLength:(NSUInteger)matchLength]];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,35 @@
+//
+//  AUTRoutingRestorationContext.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The context object that route handlers are invoked with while a routing
+/// snapshot is restored, wrapping the context that restoration was started
+/// with.
+///
+/// Routes that require a context class are invoked with the wrapped context,
+/// unless they have a handler for AUTRoutingRestorationContext itself.
+///
+/// @see -[AUTRouter restoreSnapshot:context:animated:]
+@interface AUTRoutingRestorationContext : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithContext:(nullable id)context animated:(BOOL)animated NS_DESIGNATED_INITIALIZER;
+
+/// The context that restoration was started with.
+@property (readonly, nonatomic, nullable) id context;
+
+/// Whether handlers should animate the screens that they present, which is
+/// typically NO when restoring the last screen after relaunching.
+@property (readonly, nonatomic, getter=isAnimated) BOOL animated;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,37 @@
+//
+//  AUTRoutingRestorationContext.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRoutingRestorationContext.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTRoutingRestorationContext
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithContext:(nullable id)context animated:(BOOL)animated {
+    self = [super init];
+
+    _context = context;
+    _animated = animated;
+
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> animated: %@, context: %@", self.class, self, self.animated ? @"YES" : @"NO", self.context];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
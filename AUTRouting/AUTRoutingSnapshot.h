@@ -0,0 +1,73 @@
+//
+//  AUTRoutingSnapshot.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A single hop of a routing snapshot.
+@interface AUTRoutingSnapshotHop : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRouteIdentifier:(NSString *)routeIdentifier parameters:(NSDictionary<NSString *, NSString *> *)parameters componentOffset:(NSUInteger)componentOffset matchLength:(NSUInteger)matchLength NS_DESIGNATED_INITIALIZER;
+
+/// The identifier of the route that handled the hop.
+///
+/// @see AUTRoute.identifier
+@property (readonly, nonatomic, copy) NSString *routeIdentifier;
+
+/// The parameters that the route's handler was invoked with.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, NSString *> *parameters;
+
+/// The offset of the first of the hop's components in the snapshot's
+/// components.
+@property (readonly, nonatomic) NSUInteger componentOffset;
+
+/// The number of components that the route consumed.
+@property (readonly, nonatomic) NSUInteger matchLength;
+
+@end
+
+/// The resolved chain of routes that a router routed to a URL through, which
+/// can be restored without matching any of the routes again.
+///
+/// @see -[AUTRouter restoreSnapshot:context:animated:]
+@interface AUTRoutingSnapshot : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param rootIndex The index of the root of the router that handled the first
+///        hop, in the order of the router's roots.
+- (instancetype)initWithURL:(NSURL *)url components:(NSArray<NSString *> *)components rootIndex:(NSUInteger)rootIndex hops:(NSArray<AUTRoutingSnapshotHop *> *)hops NS_DESIGNATED_INITIALIZER;
+
+/// Initializes a snapshot from its JSONObject, e.g. once it has been read back
+/// from disk after relaunching.
+///
+/// @return The snapshot, or nil if the JSON object is not a valid snapshot.
+- (nullable instancetype)initWithJSONObject:(NSDictionary<NSString *, id> *)JSONObject;
+
+/// The URL that was routed to.
+@property (readonly, nonatomic, copy) NSURL *URL;
+
+/// The components that the URL was tokenized into.
+@property (readonly, nonatomic, copy) NSArray<NSString *> *components;
+
+/// The index of the root of the router that handled the first hop.
+@property (readonly, nonatomic) NSUInteger rootIndex;
+
+/// The hops through the routing tree, in the order that they were handled.
+@property (readonly, nonatomic, copy) NSArray<AUTRoutingSnapshotHop *> *hops;
+
+/// A representation of the receiver that can be serialized with
+/// NSJSONSerialization, with the keys "url", "components", "root" and "hops",
+/// where each hop has the keys "route", "parameters", "offset" and "length".
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, id> *JSONObject;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,148 @@
+//
+//  AUTRoutingSnapshot.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRoutingSnapshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Returns the provided object if it is a kind of the given class, else nil.
+static inline id _Nullable ObjectOfClass(id _Nullable object, Class class) {
+    return [object isKindOfClass:class] ? object : nil;
+}
+
+/// Returns whether each of the keys and values of the provided dictionary are
+/// strings.
+static BOOL IsStringDictionary(NSDictionary *dictionary) {
+    AUTCAssertNotNil(dictionary);
+
+    for (id key in dictionary) {
+        if (![key isKindOfClass:NSString.class] || ![dictionary[key] isKindOfClass:NSString.class]) return NO;
+    }
+
+    return YES;
+}
+
+@implementation AUTRoutingSnapshotHop
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRouteIdentifier:(NSString *)routeIdentifier parameters:(NSDictionary<NSString *, NSString *> *)parameters componentOffset:(NSUInteger)componentOffset matchLength:(NSUInteger)matchLength {
+    AUTAssertNotNil(routeIdentifier, parameters);
+
+    self = [super init];
+
+    _routeIdentifier = [routeIdentifier copy];
+    _parameters = [parameters copy];
+    _componentOffset = componentOffset;
+    _matchLength = matchLength;
+
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> %@ offset: %lu, length: %lu, parameters: %@", self.class, self, self.routeIdentifier, (unsigned long)self.componentOffset, (unsigned long)self.matchLength, self.parameters];
+}
+
+@end
+
+@implementation AUTRoutingSnapshot
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithURL:(NSURL *)url components:(NSArray<NSString *> *)components rootIndex:(NSUInteger)rootIndex hops:(NSArray<AUTRoutingSnapshotHop *> *)hops {
+    AUTAssertNotNil(url, components, hops);
+
+    self = [super init];
+
+    _URL = [url copy];
+    _components = [components copy];
+    _rootIndex = rootIndex;
+    _hops = [hops copy];
+
+    return self;
+}
+
+- (nullable instancetype)initWithJSONObject:(NSDictionary<NSString *, id> *)JSONObject {
+    AUTAssertNotNil(JSONObject);
+
+    let urlString = (NSString *)ObjectOfClass(JSONObject[@"url"], NSString.class);
+    let url = (urlString != nil) ? [NSURL URLWithString:AUTNotNil(urlString)] : nil;
+    let components = (NSArray *)ObjectOfClass(JSONObject[@"components"], NSArray.class);
+    let rootIndex = (NSNumber *)ObjectOfClass(JSONObject[@"root"], NSNumber.class);
+    let hopObjects = (NSArray *)ObjectOfClass(JSONObject[@"hops"], NSArray.class);
+    if (url == nil || components == nil || rootIndex == nil || hopObjects == nil) return nil;
+
+    for (id component in components) {
+        if (![component isKindOfClass:NSString.class]) return nil;
+    }
+
+    let hops = [NSMutableArray<AUTRoutingSnapshotHop *> arrayWithCapacity:hopObjects.count];
+
+    for (id hopObject in hopObjects) {
+        let hop = (NSDictionary *)ObjectOfClass(hopObject, NSDictionary.class);
+        if (hop == nil) return nil;
+
+        let routeIdentifier = (NSString *)ObjectOfClass(hop[@"route"], NSString.class);
+        let parameters = (NSDictionary *)ObjectOfClass(hop[@"parameters"], NSDictionary.class);
+        let offset = (NSNumber *)ObjectOfClass(hop[@"offset"], NSNumber.class);
+        let length = (NSNumber *)ObjectOfClass(hop[@"length"], NSNumber.class);
+        if (routeIdentifier == nil || parameters == nil || offset == nil || length == nil) return nil;
+        if (!IsStringDictionary(AUTNotNil(parameters))) return nil;
+
+        // Hops must lie within the components, or restoring would read past
+        // their end.
+        if (offset.unsignedIntegerValue + length.unsignedIntegerValue > components.count) return nil;
+
+        [hops addObject:[[AUTRoutingSnapshotHop alloc]
+            initWithRouteIdentifier:AUTNotNil(routeIdentifier)
+            parameters:AUTNotNil(parameters)
+            componentOffset:offset.unsignedIntegerValue
+            matchLength:length.unsignedIntegerValue]];
+    }
+
+    return [self initWithURL:AUTNotNil(url) components:AUTNotNil(components) rootIndex:rootIndex.unsignedIntegerValue hops:hops];
+}
+
+#pragma mark - AUTRoutingSnapshot
+
+- (NSDictionary<NSString *, id> *)JSONObject {
+    let hops = [NSMutableArray<NSDictionary<NSString *, id> *> arrayWithCapacity:self.hops.count];
+
+    for (AUTRoutingSnapshotHop *hop in self.hops) {
+        [hops addObject:@{
+            @"route": hop.routeIdentifier,
+            @"parameters": hop.parameters,
+            @"offset": @(hop.componentOffset),
+            @"length": @(hop.matchLength),
+        }];
+    }
+
+    return @{
+        @"url": AUTNotNil(self.URL.absoluteString),
+        @"components": self.components,
+        @"root": @(self.rootIndex),
+        @"hops": [hops copy],
+    };
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> %@ hops: %@", self.class, self, self.URL, self.hops];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,26 @@
+//
+//  AUTRoutingTime.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+#import <mach/mach_time.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Returns the current value of a monotonic clock in seconds, suitable for
+/// measuring durations that are unaffected by changes to the system clock.
+static inline NSTimeInterval AUTRoutingMonotonicTime(void) {
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+
+    return (NSTimeInterval)(mach_absolute_time() * timebase.numer / timebase.denom) / NSEC_PER_SEC;
+}
+
+NS_ASSUME_NONNULL_END
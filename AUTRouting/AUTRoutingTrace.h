@@ -0,0 +1,102 @@
+//
+//  AUTRoutingTrace.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A single hop through the routing tree while routing to a URL.
+@interface AUTRoutingTraceHop : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRouteComponents:(NSArray<NSString *> *)routeComponents matchLength:(NSUInteger)matchLength matchDuration:(NSTimeInterval)matchDuration handlerDuration:(NSTimeInterval)handlerDuration NS_DESIGNATED_INITIALIZER;
+
+/// The pattern components of the route that was matched, or an empty array if
+/// no route matched.
+@property (readonly, nonatomic, copy) NSArray<NSString *> *routeComponents;
+
+/// The number of components that the matched route consumed.
+@property (readonly, nonatomic) NSUInteger matchLength;
+
+/// The time spent finding the matching route.
+@property (readonly, nonatomic) NSTimeInterval matchDuration;
+
+/// The time between the matching route's handler being invoked and it either
+/// sending the next routable or terminating.
+@property (readonly, nonatomic) NSTimeInterval handlerDuration;
+
+@end
+
+/// The trace of routing to a single URL.
+@interface AUTRoutingTraceRecord : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components hops:(NSArray<AUTRoutingTraceHop *> *)hops duration:(NSTimeInterval)duration succeeded:(BOOL)succeeded errorCode:(NSInteger)errorCode NS_DESIGNATED_INITIALIZER;
+
+/// The routing components of the URL that was routed to.
+@property (readonly, nonatomic, copy) NSArray<NSString *> *components;
+
+/// The hops through the routing tree, in the order that they occurred.
+@property (readonly, nonatomic, copy) NSArray<AUTRoutingTraceHop *> *hops;
+
+/// The total time spent routing to the URL.
+@property (readonly, nonatomic) NSTimeInterval duration;
+
+/// Whether routing to the URL succeeded.
+@property (readonly, nonatomic) BOOL succeeded;
+
+/// The code of the error that routing failed with, or zero if routing
+/// succeeded.
+///
+/// Usually an AUTRoutingErrorCode, unless an interceptor failed routing with
+/// an error of its own.
+@property (readonly, nonatomic) NSInteger errorCode;
+
+@end
+
+/// Records traces of routing into a fixed-capacity ring buffer, discarding the
+/// oldest records once full.
+///
+/// Records can be written to a compact line-based file format and read back in,
+/// e.g. to replay production routing in a benchmark.
+///
+/// @see -[AUTRouter traceRecorder]
+@interface AUTRoutingTraceRecorder : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param capacity The maximum number of records that are retained. Must be
+///        greater than zero.
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// The maximum number of records that are retained.
+@property (readonly, nonatomic) NSUInteger capacity;
+
+/// The retained records, from oldest to newest.
+@property (readonly, atomic, copy) NSArray<AUTRoutingTraceRecord *> *records;
+
+/// Adds the provided record, discarding the oldest record if the receiver is
+/// at capacity.
+- (void)addRecord:(AUTRoutingTraceRecord *)record;
+
+/// Discards all retained records.
+- (void)removeAllRecords;
+
+/// Writes the retained records to the file at the provided URL.
+- (BOOL)writeToURL:(NSURL *)url error:(NSError **)error;
+
+/// Reads the records from a file written by -writeToURL:error:.
+///
+/// @return The records in the file, or nil if the file could not be read or is
+///         not a valid trace file.
++ (nullable NSArray<AUTRoutingTraceRecord *> *)recordsWithContentsOfURL:(NSURL *)url error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
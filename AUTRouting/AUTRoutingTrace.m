@@ -0,0 +1,283 @@
+//
+//  AUTRoutingTrace.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+
+#import "AUTRoutingTrace.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The first line of every trace file, identifying the format and its version.
+static let TraceFileHeader = @"AUTRoutingTrace 1";
+
+/// Prefixes a line describing a record, which is followed by lines describing
+/// each of its hops.
+static let RecordLinePrefix = @"R";
+
+/// Prefixes a line describing a hop of the most recent record.
+static let HopLinePrefix = @"H";
+
+static let FieldSeparator = @"\t";
+
+static let ComponentSeparator = @"/";
+
+/// Durations are written as whole microseconds.
+static const double MicrosecondsPerSecond = 1000000.0;
+
+/// Joins the provided components into a single field, percent encoding any
+/// characters that would be ambiguous within the trace format.
+static NSString *EncodedComponents(NSArray<NSString *> *components) {
+    static NSCharacterSet *allowedCharacters;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSMutableCharacterSet *characters = [NSCharacterSet.URLPathAllowedCharacterSet mutableCopy];
+        [characters removeCharactersInString:ComponentSeparator];
+        allowedCharacters = [characters copy];
+    });
+
+    let encodedComponents = [NSMutableArray<NSString *> arrayWithCapacity:components.count];
+    for (NSString *component in components) {
+        [encodedComponents addObject:[component stringByAddingPercentEncodingWithAllowedCharacters:allowedCharacters] ?: @""];
+    }
+
+    return [encodedComponents componentsJoinedByString:ComponentSeparator];
+}
+
+/// The inverse of EncodedComponents, returning nil if the field is malformed.
+static NSArray<NSString *> * _Nullable DecodedComponents(NSString *field) {
+    if (field.length == 0) return @[];
+
+    let encodedComponents = [field componentsSeparatedByString:ComponentSeparator];
+    let components = [NSMutableArray<NSString *> arrayWithCapacity:encodedComponents.count];
+
+    for (NSString *encodedComponent in encodedComponents) {
+        let component = encodedComponent.stringByRemovingPercentEncoding;
+        if (component == nil) return nil;
+
+        [components addObject:AUTNotNil(component)];
+    }
+
+    return [components copy];
+}
+
+static NSString *EncodedDuration(NSTimeInterval duration) {
+    return [NSString stringWithFormat:@"%lld", (long long)llround(duration * MicrosecondsPerSecond)];
+}
+
+static NSTimeInterval DecodedDuration(NSString *field) {
+    return field.longLongValue / MicrosecondsPerSecond;
+}
+
+static NSError *CorruptTraceError(NSURL *url, NSUInteger lineNumber) {
+    let description = [NSString stringWithFormat:@"The routing trace at %@ is malformed at line %lu.", url.path, (unsigned long)lineNumber];
+
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{
+        NSLocalizedDescriptionKey: description,
+        NSURLErrorKey: url,
+    }];
+}
+
+@implementation AUTRoutingTraceHop
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRouteComponents:(NSArray<NSString *> *)routeComponents matchLength:(NSUInteger)matchLength matchDuration:(NSTimeInterval)matchDuration handlerDuration:(NSTimeInterval)handlerDuration {
+    AUTAssertNotNil(routeComponents);
+
+    self = [super init];
+
+    _routeComponents = [routeComponents copy];
+    _matchLength = matchLength;
+    _matchDuration = matchDuration;
+    _handlerDuration = handlerDuration;
+
+    return self;
+}
+
+@end
+
+@implementation AUTRoutingTraceRecord
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithComponents:(NSArray<NSString *> *)components hops:(NSArray<AUTRoutingTraceHop *> *)hops duration:(NSTimeInterval)duration succeeded:(BOOL)succeeded errorCode:(NSInteger)errorCode {
+    AUTAssertNotNil(components, hops);
+
+    self = [super init];
+
+    _components = [components copy];
+    _hops = [hops copy];
+    _duration = duration;
+    _succeeded = succeeded;
+    _errorCode = succeeded ? 0 : errorCode;
+
+    return self;
+}
+
+@end
+
+@implementation AUTRoutingTraceRecorder {
+    /// The ring buffer of records, which grows up to the receiver's capacity.
+    ///
+    /// Should only be accessed when synchronized on self.
+    NSMutableArray<AUTRoutingTraceRecord *> *_records;
+
+    /// The index in _records that the next record will be written to, which
+    /// is also the index of the oldest record once at capacity.
+    ///
+    /// Should only be accessed when synchronized on self.
+    NSUInteger _nextIndex;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    NSParameterAssert(capacity > 0);
+
+    self = [super init];
+
+    _capacity = capacity;
+    _records = [NSMutableArray arrayWithCapacity:capacity];
+
+    return self;
+}
+
+#pragma mark - AUTRoutingTraceRecorder
+
+- (NSArray<AUTRoutingTraceRecord *> *)records {
+    @synchronized(self) {
+        if (self->_records.count < self.capacity) return [self->_records copy];
+
+        let newest = [self->_records subarrayWithRange:NSMakeRange(0, self->_nextIndex)];
+        let oldest = [self->_records subarrayWithRange:NSMakeRange(self->_nextIndex, self->_records.count - self->_nextIndex)];
+
+        return [oldest arrayByAddingObjectsFromArray:newest];
+    }
+}
+
+- (void)addRecord:(AUTRoutingTraceRecord *)record {
+    AUTAssertNotNil(record);
+
+    @synchronized(self) {
+        if (self->_records.count < self.capacity) {
+            [self->_records addObject:record];
+        } else {
+            self->_records[self->_nextIndex] = record;
+        }
+
+        self->_nextIndex = (self->_nextIndex + 1) % self.capacity;
+    }
+}
+
+- (void)removeAllRecords {
+    @synchronized(self) {
+        [self->_records removeAllObjects];
+        self->_nextIndex = 0;
+    }
+}
+
+- (BOOL)writeToURL:(NSURL *)url error:(NSError **)error {
+    AUTAssertNotNil(url);
+
+    let records = self.records;
+    let lines = [NSMutableArray<NSString *> arrayWithObject:TraceFileHeader];
+
+    for (AUTRoutingTraceRecord *record in records) {
+        [lines addObject:[@[
+            RecordLinePrefix,
+            record.succeeded ? @"1" : @"0",
+            @(record.errorCode).stringValue,
+            EncodedDuration(record.duration),
+            EncodedComponents(record.components),
+        ] componentsJoinedByString:FieldSeparator]];
+
+        for (AUTRoutingTraceHop *hop in record.hops) {
+            [lines addObject:[@[
+                HopLinePrefix,
+                @(hop.matchLength).stringValue,
+                EncodedDuration(hop.matchDuration),
+                EncodedDuration(hop.handlerDuration),
+                EncodedComponents(hop.routeComponents),
+            ] componentsJoinedByString:FieldSeparator]];
+        }
+    }
+
+    [lines addObject:@""];
+
+    let contents = [lines componentsJoinedByString:@"\n"];
+
+    return [contents writeToURL:url atomically:YES encoding:NSUTF8StringEncoding error:error];
+}
+
++ (nullable NSArray<AUTRoutingTraceRecord *> *)recordsWithContentsOfURL:(NSURL *)url error:(NSError **)error {
+    AUTAssertNotNil(url);
+
+    let contents = [NSString stringWithContentsOfURL:url encoding:NSUTF8StringEncoding error:error];
+    if (contents == nil) return nil;
+
+    let lines = [contents componentsSeparatedByString:@"\n"];
+    if (![lines.firstObject isEqualToString:TraceFileHeader]) {
+        if (error != NULL) *error = CorruptTraceError(url, 1);
+        return nil;
+    }
+
+    let records = [NSMutableArray<AUTRoutingTraceRecord *> array];
+
+    // The fields of the record currently being read, which is only added once
+    // all of its hops have been read.
+    NSArray<NSString *> * _Nullable recordFields;
+    NSMutableArray<AUTRoutingTraceHop *> *hops = [NSMutableArray array];
+
+    void (^addRecord)(NSArray<NSString *> *) = ^(NSArray<NSString *> *fields) {
+        let components = DecodedComponents(fields[4]) ?: @[];
+
+        [records addObject:[[AUTRoutingTraceRecord alloc]
+            initWithComponents:components
+            hops:hops
+            duration:DecodedDuration(fields[3])
+            succeeded:[fields[1] isEqualToString:@"1"]
+            errorCode:fields[2].integerValue]];
+
+        [hops removeAllObjects];
+    };
+
+    for (NSUInteger index = 1; index < lines.count; index++) {
+        let line = lines[index];
+        if (line.length == 0) continue;
+
+        let fields = [line componentsSeparatedByString:FieldSeparator];
+
+        if (fields.count != 5 || DecodedComponents(fields[4]) == nil) {
+            if (error != NULL) *error = CorruptTraceError(url, index + 1);
+            return nil;
+        }
+
+        if ([fields[0] isEqualToString:RecordLinePrefix]) {
+            if (recordFields != nil) addRecord(AUTNotNil(recordFields));
+            recordFields = fields;
+        } else if ([fields[0] isEqualToString:HopLinePrefix] && recordFields != nil) {
+            [hops addObject:[[AUTRoutingTraceHop alloc]
+                initWithRouteComponents:AUTNotNil(DecodedComponents(fields[4]))
+                matchLength:(NSUInteger)fields[1].integerValue
+                matchDuration:DecodedDuration(fields[2])
+                handlerDuration:DecodedDuration(fields[3])]];
+        } else {
+            if (error != NULL) *error = CorruptTraceError(url, index + 1);
+            return nil;
+        }
+    }
+
+    if (recordFields != nil) addRecord(AUTNotNil(recordFields));
+
+    return [records copy];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,87 @@
+//
+//  AUTStaticRouteTable.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+@import Foundation;
+@import ReactiveObjC;
+
+@class AUTRoute;
+@protocol AUTRoutable;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A function used to handle a static route, with the parameters:
+/// - The target of the AUTRoutes that the route was matched by, which may be
+///   nil if the routes have no target or it has deallocated
+/// - A dictionary of the route's dynamic component and query key values
+/// - An optional context object that was provided to routing
+/// - The URL that is being routed to.
+///
+/// @return Like AUTRouteWithContextHandlerBlock.
+typedef RACSignal<id<AUTRoutable>> * _Nonnull (*AUTStaticRouteHandler)(id _Nullable target, NSDictionary<NSString *, NSString *> *parameters, id _Nullable context, NSURL *url);
+
+/// A route that is declared in constant data.
+typedef struct AUTStaticRoute {
+    /// The route's components as UTF-8 string literals, terminated by NULL.
+    const char * _Nullable const * _Nonnull components;
+
+    /// The function invoked when the route is handled.
+    AUTStaticRouteHandler handler;
+} AUTStaticRoute;
+
+/// Declares an AUTStaticRoute with the provided handler function and component
+/// string literals, e.g. AUT_STATIC_ROUTE(HandleUser, "user", ":user_id").
+#define AUT_STATIC_ROUTE(HANDLER, ...) \
+    { (const char * const []){ __VA_ARGS__, NULL }, (HANDLER) }
+
+/// Declares a function with the provided name that returns a shared static
+/// route table of the provided AUT_STATIC_ROUTEs, e.g.:
+///
+///     AUT_STATIC_ROUTE_TABLE(ChildRouteTable,
+///         AUT_STATIC_ROUTE(HandleUser, "user", ":user_id"),
+///         AUT_STATIC_ROUTE(HandleInbox, "inbox", "?[tab]"))
+///
+/// The routes are stored as constant data, and the table is only created the
+/// first time that the function is called.
+#define AUT_STATIC_ROUTE_TABLE(NAME, ...) \
+    static const AUTStaticRoute NAME##Routes[] = { __VA_ARGS__ }; \
+    static AUTStaticRouteTable *NAME(void) { \
+        static AUTStaticRouteTable *table; \
+        static dispatch_once_t onceToken; \
+        dispatch_once(&onceToken, ^{ \
+            table = [[AUTStaticRouteTable alloc] initWithRoutes:NAME##Routes count:sizeof(NAME##Routes) / sizeof(AUTStaticRoute)]; \
+        }); \
+        return table; \
+    }
+
+/// An immutable table of routes declared in constant data, which can be shared
+/// between any number of AUTRoutes as the base layer of their routes.
+///
+/// @see -[AUTRoutes initWithStaticRouteTable:target:]
+@interface AUTStaticRouteTable : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param routes The routes of the table, which are not copied, so must remain
+///        valid for the lifetime of the table, e.g. by being constant data.
+///        An exception is thrown if two routes have the same components.
+///
+/// @param count The number of routes.
+- (instancetype)initWithRoutes:(const AUTStaticRoute *)routes count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+/// The number of routes in the receiver.
+@property (readonly, nonatomic) NSUInteger count;
+
+/// The receiver's routes, in the order that they were declared.
+///
+/// Routes are created along with the receiver, once for all of the AUTRoutes
+/// that share it. Tables declared with AUT_STATIC_ROUTE_TABLE are only created
+/// the first time that they are needed.
+@property (readonly, nonatomic, copy) NSArray<AUTRoute *> *routes;
+
+@end
+
+NS_ASSUME_NONNULL_END
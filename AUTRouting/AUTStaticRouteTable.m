@@ -0,0 +1,71 @@
+//
+//  AUTStaticRouteTable.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTExtObjC.h"
+#import "AUTRoute_Private.h"
+
+#import "AUTStaticRouteTable_Private.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTStaticRouteTable {
+    const AUTStaticRoute *_staticRoutes;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRoutes:(const AUTStaticRoute *)routes count:(NSUInteger)count {
+    NSParameterAssert(routes != NULL || count == 0);
+
+    self = [super init];
+
+    _staticRoutes = routes;
+    _count = count;
+
+    // Created up front and never mutated, so that they can be read while
+    // matching without synchronizing.
+    _routes = [self createRoutes];
+    _routeSet = [NSSet setWithArray:_routes];
+
+    let routesByIdentifier = [NSMutableDictionary<NSString *, AUTRoute *> dictionaryWithCapacity:_routes.count];
+    for (AUTRoute *route in _routes) {
+        routesByIdentifier[route.identifier] = route;
+    }
+
+    _routesByIdentifier = [routesByIdentifier copy];
+
+    return self;
+}
+
+#pragma mark - Private
+
+- (NSArray<AUTRoute *> *)createRoutes {
+    let routes = [NSMutableArray<AUTRoute *> arrayWithCapacity:self.count];
+
+    for (NSUInteger index = 0; index < self.count; index++) {
+        let staticRoute = _staticRoutes[index];
+        NSParameterAssert(staticRoute.handler != NULL);
+
+        let components = [NSMutableArray<NSString *> array];
+        for (const char * const *component = staticRoute.components; *component != NULL; component++) {
+            [components addObject:AUTNotNil(@(*component))];
+        }
+
+        let route = [[AUTRoute alloc] initWithComponents:components staticHandler:staticRoute.handler table:self index:index];
+        NSAssert(![routes containsObject:route], @"%@ declares %@ more than once", self, route.identifier);
+
+        [routes addObject:route];
+    }
+
+    return [routes copy];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,22 @@
+//
+//  AUTStaticRouteTable_Private.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <AUTRouting/AUTStaticRouteTable.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface AUTStaticRouteTable ()
+
+/// The receiver's routes as a set, created alongside routes.
+@property (readonly, nonatomic, copy) NSSet<AUTRoute *> *routeSet;
+
+/// The receiver's routes keyed by identifier, created alongside routes.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, AUTRoute *> *routesByIdentifier;
+
+@end
+
+NS_ASSUME_NONNULL_END
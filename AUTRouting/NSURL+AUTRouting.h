@@ -10,6 +10,18 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Options that adjust how a URL is split into routing components.
+typedef NS_OPTIONS(NSUInteger, AUTRoutingTokenizerOptions) {
+    /// The host is lowercased, so that it matches lowercase host routes
+    /// regardless of how the link was capitalized.
+    AUTRoutingTokenizerOptionFoldHostCase = 1 << 0,
+
+    /// Components that contain percent-encoded non-ASCII characters are
+    /// converted to Unicode Normalization Form C, so that they match routes
+    /// regardless of how the link was composed.
+    AUTRoutingTokenizerOptionNormalizeUnicode = 1 << 1,
+};
+
 @interface NSURL (AUTRouting)
 
 /// Returns the routable component strings in the receiver.
@@ -17,8 +29,26 @@ NS_ASSUME_NONNULL_BEGIN
 /// If the URL includes a host (e.g. https://automatic.com/app ), the host
 /// "automatic.com" will be the first component, and "app" will be the second
 /// component.
+///
+/// Equivalent to tokenizing the receiver without any options, so that it
+/// produces the same components as a router with no tokenizer options.
 @property (readonly, nonatomic, copy) NSArray<NSString *> *aut_routingComponents;
 
+/// Returns the routable component strings in the receiver, tokenized in a
+/// single pass over its UTF-8 bytes with the provided options applied.
+///
+/// Components are only percent-decoded if they contain a "%", and are otherwise
+/// created directly from the receiver's bytes without any intermediate copies.
+/// Empty components and the parameter string, query and fragment are omitted.
+- (NSArray<NSString *> *)aut_routingComponentsWithOptions:(AUTRoutingTokenizerOptions)options;
+
+/// The parameters in the receiver's query string, parsed in a single pass over
+/// its UTF-8 bytes.
+///
+/// Keys and values are percent-decoded. Keys without a value map to an empty
+/// string, and only the first value of a repeated key is included.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, NSString *> *aut_queryParameters;
+
 /// Returns whether the receiver has at least one routing component.
 @property (readonly, nonatomic) BOOL aut_isRoutable;
 
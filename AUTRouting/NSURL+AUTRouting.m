@@ -12,25 +12,177 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// The size of the stack buffers that URL bytes are tokenized with, above
+/// which heap buffers are used instead.
+static const CFIndex StackBufferSize = 512;
+
+static inline int HexDigitValue(uint8_t character) {
+    if (character >= '0' && character <= '9') return character - '0';
+    if (character >= 'a' && character <= 'f') return character - 'a' + 10;
+    if (character >= 'A' && character <= 'F') return character - 'A' + 10;
+    return -1;
+}
+
+/// Creates a string from the provided URL bytes, applying the provided options.
+///
+/// Bytes that contain neither a "%" nor a character to case-fold are converted
+/// directly. Otherwise they are decoded into the scratch buffer, which must be
+/// at least as long as the bytes, falling back to the undecoded bytes if the
+/// decoded bytes are not valid UTF-8.
+static NSString * _Nullable ComponentString(const uint8_t *bytes, NSUInteger length, BOOL containsPercent, BOOL foldsCase, AUTRoutingTokenizerOptions options, uint8_t *scratch) {
+    NSCParameterAssert(bytes != NULL && scratch != NULL);
+
+    if (length == 0) return nil;
+
+    if (!containsPercent && !foldsCase) {
+        return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+    }
+
+    NSUInteger decodedLength = 0;
+    BOOL containsNonASCII = NO;
+
+    for (NSUInteger index = 0; index < length; index++) {
+        uint8_t character = bytes[index];
+
+        if (character == '%' && index + 2 < length) {
+            let high = HexDigitValue(bytes[index + 1]);
+            let low = HexDigitValue(bytes[index + 2]);
+
+            if (high >= 0 && low >= 0) {
+                character = (uint8_t)((high << 4) | low);
+                index += 2;
+            }
+        } else if (foldsCase && character >= 'A' && character <= 'Z') {
+            character += 'a' - 'A';
+        }
+
+        containsNonASCII = containsNonASCII || character >= 0x80;
+        scratch[decodedLength++] = character;
+    }
+
+    NSString *decoded = [[NSString alloc] initWithBytes:scratch length:decodedLength encoding:NSUTF8StringEncoding];
+    if (decoded == nil) {
+        return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+    }
+
+    if (containsNonASCII && (options & AUTRoutingTokenizerOptionNormalizeUnicode) != 0) {
+        decoded = decoded.precomposedStringWithCanonicalMapping;
+    }
+
+    return decoded;
+}
+
 @implementation NSURL (AUTRouting)
 
 - (NSArray<NSString *> *)aut_routingComponents {
-    let host = self.host;
-    var pathComponents = self.pathComponents;
+    return [self aut_routingComponentsWithOptions:0];
+}
+
+- (NSArray<NSString *> *)aut_routingComponentsWithOptions:(AUTRoutingTokenizerOptions)options {
+    let url = (__bridge CFURLRef)self.absoluteURL;
+
+    let length = CFURLGetBytes(url, NULL, 0);
+    if (length <= 0) return @[];
+
+    // The first half of the buffer holds the URL's bytes, and the second half
+    // is scratch space for decoding components.
+    uint8_t stackBuffer[StackBufferSize * 2];
+    uint8_t *bytes = (length <= StackBufferSize) ? stackBuffer : malloc((size_t)length * 2);
+    uint8_t *scratch = bytes + length;
+    CFURLGetBytes(url, bytes, length);
 
-    if (pathComponents.count == 0) {
-        return (host != nil) ? @[ host ] : @[];
+    let components = [NSMutableArray<NSString *> array];
+
+    let hostRange = CFURLGetByteRangeForComponent(url, kCFURLComponentHost, NULL);
+    if (hostRange.location != kCFNotFound && hostRange.length > 0) {
+        let hostBytes = bytes + hostRange.location;
+        let containsPercent = (memchr(hostBytes, '%', (size_t)hostRange.length) != NULL);
+        let foldsCase = (options & AUTRoutingTokenizerOptionFoldHostCase) != 0;
+
+        let host = ComponentString(hostBytes, (NSUInteger)hostRange.length, containsPercent, foldsCase, options, scratch);
+        if (host != nil) [components addObject:AUTNotNil(host)];
     }
 
-    if ([pathComponents[0] isEqualToString:@"/"]) {
-        pathComponents = [pathComponents subarrayWithRange:NSMakeRange(1, pathComponents.count - 1)];
+    let pathRange = CFURLGetByteRangeForComponent(url, kCFURLComponentPath, NULL);
+    if (pathRange.location != kCFNotFound) {
+        let pathEnd = pathRange.location + pathRange.length;
+        var segmentStart = pathRange.location;
+        var containsPercent = NO;
+
+        for (CFIndex index = pathRange.location; index <= pathEnd; index++) {
+            let isSeparator = (index == pathEnd || bytes[index] == '/' || bytes[index] == ';');
+
+            if (!isSeparator) {
+                containsPercent = containsPercent || bytes[index] == '%';
+                continue;
+            }
+
+            let segment = ComponentString(bytes + segmentStart, (NSUInteger)(index - segmentStart), containsPercent, NO, options, scratch);
+            if (segment != nil) [components addObject:AUTNotNil(segment)];
+
+            // Path parameters are not routed.
+            if (index < pathEnd && bytes[index] == ';') break;
+
+            segmentStart = index + 1;
+            containsPercent = NO;
+        }
     }
 
-    if (host != nil) {
-        pathComponents = [@[ host ] arrayByAddingObjectsFromArray:pathComponents];
+    if (bytes != stackBuffer) free(bytes);
+
+    return [components copy];
+}
+
+- (NSDictionary<NSString *, NSString *> *)aut_queryParameters {
+    let url = (__bridge CFURLRef)self.absoluteURL;
+
+    let queryRange = CFURLGetByteRangeForComponent(url, kCFURLComponentQuery, NULL);
+    if (queryRange.location == kCFNotFound || queryRange.length == 0) return @{};
+
+    let length = CFURLGetBytes(url, NULL, 0);
+
+    uint8_t stackBuffer[StackBufferSize * 2];
+    uint8_t *bytes = (length <= StackBufferSize) ? stackBuffer : malloc((size_t)length * 2);
+    uint8_t *scratch = bytes + length;
+    CFURLGetBytes(url, bytes, length);
+
+    let parameters = [NSMutableDictionary<NSString *, NSString *> dictionary];
+
+    let queryEnd = queryRange.location + queryRange.length;
+    var pairStart = queryRange.location;
+    CFIndex separatorIndex = kCFNotFound;
+    var containsPercent = NO;
+
+    for (CFIndex index = queryRange.location; index <= queryEnd; index++) {
+        if (index < queryEnd && bytes[index] != '&') {
+            if (bytes[index] == '=' && separatorIndex == kCFNotFound) {
+                separatorIndex = index;
+            }
+
+            containsPercent = containsPercent || bytes[index] == '%';
+            continue;
+        }
+
+        let keyEnd = (separatorIndex != kCFNotFound) ? separatorIndex : index;
+        let key = ComponentString(bytes + pairStart, (NSUInteger)(keyEnd - pairStart), containsPercent, NO, 0, scratch);
+
+        if (key != nil && parameters[AUTNotNil(key)] == nil) {
+            NSString *value;
+            if (separatorIndex != kCFNotFound) {
+                value = ComponentString(bytes + separatorIndex + 1, (NSUInteger)(index - separatorIndex - 1), containsPercent, NO, 0, scratch);
+            }
+
+            parameters[AUTNotNil(key)] = value ?: @"";
+        }
+
+        pairStart = index + 1;
+        separatorIndex = kCFNotFound;
+        containsPercent = NO;
     }
 
-    return pathComponents;
+    if (bytes != stackBuffer) free(bytes);
+
+    return [parameters copy];
 }
 
 - (BOOL)aut_isRoutable {
@@ -22,8 +22,16 @@ NS_ASSUME_NONNULL_BEGIN
 /// remaining components. If the command's execution signal sends a view model
 /// that conforms to AUTRoutable it will be sent the remaining route components
 /// to be handled.
+///
+/// @see -[AUTRoute initWithComponents:command:input:]
 - (nullable AUTRoute *)aut_execute:(nullable InputType)input whenRoutes:(AUTRoutes *)routes handleRoute:(NSArray<NSString *> *)routeComponents;
 
+/// Like -aut_execute:whenRoutes:handleRoute:, but the route is removed from the
+/// routes automatically when the provided owner deallocates.
+///
+/// @see -[AUTRoutes addRoute:owner:]
+- (nullable AUTRoute *)aut_execute:(nullable InputType)input whenRoutes:(AUTRoutes *)routes handleRoute:(NSArray<NSString *> *)routeComponents owner:(id)owner;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,7 +7,6 @@
 //
 
 #import "AUTExtObjC.h"
-#import "AUTRoutable.h"
 
 #import "RACCommand+AUTRoutes.h"
 
@@ -17,23 +16,24 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable AUTRoute *)aut_execute:(nullable id)input whenRoutes:(AUTRoutes *)routes handleRoute:(NSArray<NSString *> *)routeComponents {
     AUTAssertNotNil(routes, routeComponents);
-    
-    @weakify(self);
-
-    let execute = [[[RACSignal
-        defer:^{
-            @strongifyOr(self) return [RACSignal empty];
-            
-            return [self execute:input];
-        }]
-        // Take just the first presented routable in case the execution signal
-        // has a longer lifecycle.
-        take:1]
-        filter:^(id routable) {
-            return [routable conformsToProtocol:@protocol(AUTRoutable)];
-        }];
-
-    return [routes addRoute:routeComponents withSignal:execute];
+
+    return [routes addRoute:[self aut_routeExecuting:input forComponents:routeComponents]];
+}
+
+- (nullable AUTRoute *)aut_execute:(nullable id)input whenRoutes:(AUTRoutes *)routes handleRoute:(NSArray<NSString *> *)routeComponents owner:(id)owner {
+    AUTAssertNotNil(routes, routeComponents, owner);
+
+    return [routes addRoute:[self aut_routeExecuting:input forComponents:routeComponents] owner:owner];
+}
+
+#pragma mark - Private
+
+/// Returns a route that executes the receiver with the provided input when it
+/// is handled.
+- (AUTRoute *)aut_routeExecuting:(nullable id)input forComponents:(NSArray<NSString *> *)routeComponents {
+    AUTAssertNotNil(routeComponents);
+
+    return [[AUTRoute alloc] initWithComponents:routeComponents command:self input:input];
 }
 
 @end
@@ -0,0 +1,162 @@
+//
+//  AUTDeferredRouterSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTStubRoutable.h"
+
+SpecBegin(AUTDeferredRouter)
+
+__block BOOL success;
+__block NSError *error;
+__block AUTStubRoutable *routable;
+__block AUTRouter *router;
+__block AUTDeferredRouter *deferredRouter;
+__block NSMutableArray<NSString *> *handledRoutes;
+
+beforeEach(^{
+    success = NO;
+    error = nil;
+
+    routable = [[AUTStubRoutable alloc] init];
+    router = [[AUTRouter alloc] initWithRootRoutes:routable.routes];
+    deferredRouter = [[AUTDeferredRouter alloc] initWithCapacity:2];
+
+    handledRoutes = [NSMutableArray array];
+
+    [routable.routes addRoute:@[ @"record" ] withSingleTokenHandler:^(NSString *name, NSURL *url) {
+        [handledRoutes addObject:name];
+        return [RACSignal empty];
+    }];
+});
+
+it(@"should buffer URLs until a router is attached and then route to them in order", ^{
+    [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first"], nil)];
+    let lastExecution = [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/second"], nil)];
+    expect(deferredRouter.bufferedURLCount).to.equal(2);
+    expect(handledRoutes).to.haveCountOf(0);
+
+    [deferredRouter attachRouter:router];
+
+    success = [lastExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal((@[ @"first", @"second" ]));
+    expect(deferredRouter.bufferedURLCount).to.equal(0);
+});
+
+it(@"should route to URLs buffered while draining after the URLs buffered before", ^{
+    let slowRouting = [RACSubject subject];
+    [routable.routes addRoute:@[ @"slow" ] withHandler:^(NSDictionary *parameters, NSURL *url) {
+        [handledRoutes addObject:@"slow"];
+        return slowRouting;
+    }];
+
+    [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/slow"], nil)];
+    [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first"], nil)];
+
+    [deferredRouter attachRouter:router];
+    expect(handledRoutes).to.equal(@[ @"slow" ]);
+
+    let lastExecution = [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/second"], nil)];
+    expect(deferredRouter.bufferedURLCount).to.equal(2);
+
+    [slowRouting sendCompleted];
+
+    success = [lastExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal((@[ @"slow", @"first", @"second" ]));
+    expect(deferredRouter.bufferedURLCount).to.equal(0);
+});
+
+it(@"should buffer equivalent URLs once", ^{
+    let firstExecution = [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first"], nil)];
+    let secondExecution = [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"other:/record/first"], nil)];
+    let queryExecution = [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first?query"], nil)];
+    expect(deferredRouter.bufferedURLCount).to.equal(2);
+
+    [deferredRouter attachRouter:router];
+
+    success = [firstExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    success = [secondExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    success = [queryExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal((@[ @"first", @"first" ]));
+});
+
+it(@"should buffer the same URL with different contexts separately", ^{
+    let url = [NSURL URLWithString:@"custom:/record/first"];
+    let firstExecution = [deferredRouter.handleURL execute:RACTuplePack(url, @"first context")];
+    let secondExecution = [deferredRouter.handleURL execute:RACTuplePack(url, @"second context")];
+    expect(deferredRouter.bufferedURLCount).to.equal(2);
+
+    [deferredRouter attachRouter:router];
+
+    success = [firstExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    success = [secondExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal((@[ @"first", @"first" ]));
+});
+
+it(@"should remove a buffered URL when its last subscriber disposes", ^{
+    let routing = [deferredRouter routingSignalForURL:[NSURL URLWithString:@"custom:/record/first"] context:nil];
+    let firstDisposable = [routing subscribeCompleted:^{}];
+    let secondDisposable = [routing subscribeCompleted:^{}];
+    expect(deferredRouter.bufferedURLCount).to.equal(1);
+
+    [firstDisposable dispose];
+    expect(deferredRouter.bufferedURLCount).to.equal(1);
+
+    [secondDisposable dispose];
+    expect(deferredRouter.bufferedURLCount).to.equal(0);
+
+    [deferredRouter attachRouter:router];
+
+    success = [[deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/second"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal(@[ @"second" ]);
+});
+
+it(@"should drop the oldest URL when at capacity", ^{
+    let url = [NSURL URLWithString:@"custom:/record/first"];
+    let firstExecution = [deferredRouter.handleURL execute:RACTuplePack(url, nil)];
+    [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/second"], nil)];
+    [deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/third"], nil)];
+
+    success = [firstExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(error.domain).to.equal(AUTRoutingErrorDomain);
+    expect(error.code).to.equal(AUTRoutingErrorCodeDropped);
+    expect(error.userInfo[AUTRoutingErrorURLKey]).to.equal(url);
+    expect(deferredRouter.droppedCount).to.equal(1);
+    expect(deferredRouter.bufferedURLCount).to.equal(2);
+});
+
+it(@"should fail to buffer a URL without routable components", ^{
+    success = [[deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(error.domain).to.equal(AUTRoutingErrorDomain);
+    expect(error.code).to.equal(AUTRoutingErrorCodeInvalidURL);
+    expect(deferredRouter.bufferedURLCount).to.equal(0);
+});
+
+it(@"should forward URLs to the router once attached", ^{
+    [deferredRouter attachRouter:router];
+    expect(deferredRouter.router).to.beIdenticalTo(router);
+
+    success = [[deferredRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal(@[ @"first" ]);
+    expect(deferredRouter.bufferedURLCount).to.equal(0);
+});
+
+SpecEnd
@@ -9,9 +9,28 @@
 #import <specta/specta.h>
 #import <expecta/expecta.h>
 #import <AUTRouting/AUTRouting.h>
+#import <AUTRouting/AUTRoute_Private.h>
 
 #import "AUTExtObjC.h"
 #import "AUTStubRoutable.h"
+#import "AUTStubRoutingInterceptor.h"
+
+/// Records the thread that its parameters were extracted on.
+@interface AUTParameterRecordingRoute : AUTRoute
+
+@property (atomic) BOOL extractedParametersOnMainThread;
+
+@end
+
+@implementation AUTParameterRecordingRoute
+
+- (NSDictionary<NSString *, NSString *> *)parametersForComponents:(NSArray<NSString *> *)components matchLength:(NSInteger)matchLength queryParameters:(nullable NSDictionary<NSString *, NSString *> *)queryParameters {
+    self.extractedParametersOnMainThread = NSThread.isMainThread;
+
+    return [super parametersForComponents:components matchLength:matchLength queryParameters:queryParameters];
+}
+
+@end
 
 SpecBegin(AUTRouter)
 
@@ -164,6 +183,337 @@ describe(@"routing to URLs", ^{
         });
     });
 
+    context(@"with a concurrency policy of latest wins", ^{
+        beforeEach(^{
+            router.concurrencyPolicy = AUTRouterConcurrencyPolicyLatestWins;
+
+            [routable.routes addRoute:@[ @"stale" ] withSignal:[RACSignal never]];
+            [routable.routes addRoute:@[ @"latest" ] withSignal:[RACSignal empty]];
+        });
+
+        it(@"should cancel routing that is in progress when a more recent URL is routed to", ^{
+            let staleURL = [[NSURL alloc] initWithString:@"custom:/stale"];
+            let latestURL = [[NSURL alloc] initWithString:@"custom:/latest"];
+
+            let staleExecution = [router.handleURL execute:RACTuplePack(staleURL, nil)];
+            let latestTuple = [[router.handleURL execute:RACTuplePack(latestURL, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+
+            expect(latestTuple.first).to.equal(latestURL);
+            expect(success).to.beTruthy();
+
+            success = [staleExecution asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beFalsy();
+            expect(error.domain).to.equal(AUTRoutingErrorDomain);
+            expect(error.code).to.equal(AUTRoutingErrorCodeCancelled);
+            expect(error.userInfo[AUTRoutingErrorURLKey]).to.equal(staleURL);
+        });
+    });
+
+    context(@"routing as deep as possible", ^{
+        beforeEach(^{
+            router.routesAsDeepAsPossible = YES;
+
+            let nextRoutable = [[AUTStubRoutable alloc] init];
+            [nextRoutable.routes addRoute:@[ @"city" ] withSignal:[RACSignal empty]];
+
+            [routable.routes addRoute:@[ @"state" ] withSignal:[RACSignal return:nextRoutable]];
+        });
+
+        it(@"should stop at the deepest routable and send the unconsumed components", ^{
+            let url = [[NSURL alloc] initWithString:@"custom:/state/county/district"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(tuple).to.haveCountOf(3);
+            expect(tuple.first).to.equal(url);
+            expect(tuple.last).to.equal((@[ @"county", @"district" ]));
+        });
+
+        it(@"should send the URL and context if every component was consumed", ^{
+            let url = [[NSURL alloc] initWithString:@"custom:/state/city"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(tuple).to.haveCountOf(2);
+        });
+
+        it(@"should error if no root route matches", ^{
+            let url = [[NSURL alloc] initWithString:@"custom:/country"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple).to.beNil();
+            expect(error.code).to.equal(AUTRoutingErrorCodeNoMatchFound);
+        });
+    });
+
+    context(@"with a coalescing interval", ^{
+        __block NSUInteger handlerInvocations;
+
+        beforeEach(^{
+            handlerInvocations = 0;
+            router.coalescingInterval = 0.05;
+
+            [routable.routes addRoute:@[ @"inbox" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                handlerInvocations++;
+                return [RACSignal empty];
+            }];
+            [routable.routes addRoute:@[ @"settings" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                handlerInvocations++;
+                return [RACSignal empty];
+            }];
+        });
+
+        it(@"should merge equal URLs into a single routing with a shared outcome", ^{
+            router.coalescedContextPolicy = AUTRouterCoalescedContextPolicyKeepLatest;
+
+            let url = [[NSURL alloc] initWithString:@"custom:/inbox"];
+            let firstExecution = [router.handleURL execute:RACTuplePack(url, @1)];
+            let secondExecution = [router.handleURL execute:RACTuplePack(url, @2)];
+
+            let firstTuple = [firstExecution asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            let secondTuple = [secondExecution asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+
+            expect(handlerInvocations).to.equal(1);
+            expect(firstTuple).to.equal(RACTuplePack(url, @2));
+            expect(secondTuple).to.equal(RACTuplePack(url, @2));
+        });
+
+        it(@"should reject a different URL while another is pending", ^{
+            let inboxURL = [[NSURL alloc] initWithString:@"custom:/inbox"];
+            let settingsURL = [[NSURL alloc] initWithString:@"custom:/settings"];
+
+            let inboxExecution = [router.handleURL execute:RACTuplePack(inboxURL, nil)];
+            success = [[router.handleURL execute:RACTuplePack(settingsURL, nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beFalsy();
+            expect(error.domain).to.equal(RACCommandErrorDomain);
+
+            success = [inboxExecution asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handlerInvocations).to.equal(1);
+        });
+
+        it(@"should replace a pending URL with the most recent URL", ^{
+            router.coalescingPolicy = AUTRouterCoalescingPolicyLatestReplaces;
+
+            let inboxURL = [[NSURL alloc] initWithString:@"custom:/inbox"];
+            let settingsURL = [[NSURL alloc] initWithString:@"custom:/settings"];
+
+            let inboxExecution = [router.handleURL execute:RACTuplePack(inboxURL, nil)];
+            let settingsExecution = [router.handleURL execute:RACTuplePack(settingsURL, nil)];
+
+            let inboxTuple = [inboxExecution asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(inboxTuple.first).to.equal(settingsURL);
+
+            success = [settingsExecution asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handlerInvocations).to.equal(1);
+        });
+    });
+
+    context(@"with deadlines", ^{
+        beforeEach(^{
+            [routable.routes addRoute:@[ @"hung" ] withSignal:[RACSignal never]];
+        });
+
+        it(@"should error if a single route handler exceeds the hop timeout", ^{
+            router.hopTimeout = 0.01;
+
+            let url = [[NSURL alloc] initWithString:@"custom:/hung"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple).to.beNil();
+
+            expect(error.domain).to.equal(AUTRoutingErrorDomain);
+            expect(error.code).to.equal(AUTRoutingErrorCodeTimedOut);
+            expect(error.userInfo[AUTRoutingErrorURLKey]).to.equal(url);
+            expect(error.userInfo[AUTRoutingErrorRemainingComponentsKey]).to.equal(@[ @"hung" ]);
+        });
+
+        it(@"should error if routing exceeds the total timeout", ^{
+            router.timeout = 0.01;
+
+            let url = [[NSURL alloc] initWithString:@"custom:/hung"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple).to.beNil();
+
+            expect(error.domain).to.equal(AUTRoutingErrorDomain);
+            expect(error.code).to.equal(AUTRoutingErrorCodeTimedOut);
+            expect(error.userInfo[AUTRoutingErrorURLKey]).to.equal(url);
+        });
+    });
+
+    context(@"with interceptors", ^{
+        __block AUTStubRoutingInterceptor *interceptor;
+
+        beforeEach(^{
+            interceptor = [[AUTStubRoutingInterceptor alloc] init];
+            router.interceptors = @[ interceptor ];
+
+            [routable.routes addRoute:@[ @"new-path" ] withSignal:[RACSignal empty]];
+        });
+
+        it(@"should route to a URL rewritten before tokenizing", ^{
+            let legacyURL = [[NSURL alloc] initWithString:@"custom:/legacy-path"];
+            let rewrittenURL = [[NSURL alloc] initWithString:@"custom:/new-path"];
+
+            interceptor.willTokenizeURL = ^(NSURL *url, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                return [url isEqual:legacyURL] ? rewrittenURL : url;
+            };
+
+            let tuple = [[router.handleURL execute:RACTuplePack(legacyURL, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple.first).to.equal(legacyURL);
+            expect(success).to.beTruthy();
+        });
+
+        it(@"should route rewritten components", ^{
+            interceptor.willHandleComponents = ^(NSArray<NSString *> *components, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                return @[ @"new-path" ];
+            };
+
+            let url = [[NSURL alloc] initWithString:@"custom:/legacy-path"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple.first).to.equal(url);
+            expect(success).to.beTruthy();
+        });
+
+        it(@"should error with the interceptor's error when short-circuited", ^{
+            let interceptorError = [NSError errorWithDomain:@"AUTRouterSpec" code:-1 userInfo:nil];
+
+            interceptor.willHandleComponents = ^ NSArray<NSString *> * (NSArray<NSString *> *components, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                *error = interceptorError;
+                return nil;
+            };
+
+            let url = [[NSURL alloc] initWithString:@"custom:/new-path"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple).to.beNil();
+            expect(error).to.beIdenticalTo(interceptorError);
+        });
+
+        it(@"should trace routing that is stopped before tokenizing", ^{
+            let recorder = [[AUTRoutingTraceRecorder alloc] initWithCapacity:2];
+            router.traceRecorder = recorder;
+
+            interceptor.willTokenizeURL = ^ NSURL * (NSURL *url, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                return nil;
+            };
+
+            let url = [[NSURL alloc] initWithString:@"custom:/new-path"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple.first).to.equal(url);
+            expect(success).to.beTruthy();
+
+            expect(recorder.records).to.haveCountOf(1);
+            expect(recorder.records.firstObject.succeeded).to.beTruthy();
+            expect(recorder.records.firstObject.hops).to.haveCountOf(0);
+        });
+
+        it(@"should share annotations between hooks", ^{
+            __block id annotation;
+
+            interceptor.willHandleComponents = ^(NSArray<NSString *> *components, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                annotations[@"started"] = @YES;
+                return components;
+            };
+
+            interceptor.didHandleComponents = ^(NSArray<NSString *> *components, id<AUTRoutable> routable, NSMutableDictionary<NSString *, id> *annotations) {
+                annotation = annotations[@"started"];
+            };
+
+            let url = [[NSURL alloc] initWithString:@"custom:/new-path"];
+            [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(annotation).to.equal(@YES);
+        });
+    });
+
+    context(@"with a matching scheduler", ^{
+        __block AUTStubRoutingInterceptor *interceptor;
+        __block NSMutableArray<NSNumber *> *matchedOnMainThread;
+
+        beforeEach(^{
+            router.matchingScheduler = [RACScheduler schedulerWithPriority:RACSchedulerPriorityHigh];
+
+            matchedOnMainThread = [NSMutableArray array];
+
+            interceptor = [[AUTStubRoutingInterceptor alloc] init];
+            interceptor.willHandleComponents = ^(NSArray<NSString *> *components, NSMutableDictionary<NSString *, id> *annotations, NSError **error) {
+                @synchronized (matchedOnMainThread) {
+                    [matchedOnMainThread addObject:@(NSThread.isMainThread)];
+                }
+                return components;
+            };
+            router.interceptors = @[ interceptor ];
+        });
+
+        it(@"should match off of the main thread and invoke handlers on the main thread", ^{
+            __block BOOL handledOnMainThread = NO;
+
+            let nextRoutable = [[AUTStubRoutable alloc] init];
+            [nextRoutable.routes addRoute:@[ @"city" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                handledOnMainThread = NSThread.isMainThread;
+                return [RACSignal empty];
+            }];
+
+            [routable.routes addRoute:@[ @"state" ] withSignal:[RACSignal return:nextRoutable]];
+
+            let url = [[NSURL alloc] initWithString:@"custom:/state/city"];
+            let tuple = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(tuple.first).to.equal(url);
+            expect(success).to.beTruthy();
+
+            expect(handledOnMainThread).to.beTruthy();
+            expect(matchedOnMainThread).to.equal((@[ @NO, @NO ]));
+        });
+
+        it(@"should invoke handlers on their route's scheduler", ^{
+            let routeScheduler = [RACScheduler schedulerWithPriority:RACSchedulerPriorityLow];
+            __block RACScheduler *handlerScheduler;
+
+            let route = [routable.routes addRoute:@[ @"state" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                handlerScheduler = RACScheduler.currentScheduler;
+                return [RACSignal empty];
+            }];
+            route.scheduler = routeScheduler;
+
+            let url = [[NSURL alloc] initWithString:@"custom:/state"];
+            [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(handlerScheduler).to.beIdenticalTo(routeScheduler);
+        });
+
+        it(@"should invoke fallback handlers on the main thread", ^{
+            __block BOOL handledOnMainThread = NO;
+
+            routable.routes.fallbackHandler = ^(NSArray<NSString *> *components, id context, NSURL *url) {
+                handledOnMainThread = NSThread.isMainThread;
+                return [RACSignal empty];
+            };
+
+            let url = [[NSURL alloc] initWithString:@"custom:/unknown"];
+            [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(handledOnMainThread).to.beTruthy();
+            expect(matchedOnMainThread).to.equal(@[ @NO ]);
+        });
+
+        it(@"should extract parameters off of the main thread", ^{
+            __block NSString *state;
+
+            let route = [[AUTParameterRecordingRoute alloc] initWithComponents:@[ @"state", @":state" ] handler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                state = parameters[@"state"];
+                return [RACSignal empty];
+            }];
+            route.extractedParametersOnMainThread = YES;
+            [routable.routes addRoute:route];
+
+            let url = [[NSURL alloc] initWithString:@"custom:/state/california"];
+            [[router.handleURL execute:RACTuplePack(url, nil)] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(state).to.equal(@"california");
+            expect(route.extractedParametersOnMainThread).to.beFalsy();
+        });
+    });
+
     context(@"with nested routables", ^{
         it(@"should handle a URL", ^{
             RACSubject<NSString *> *handledTokens = [RACReplaySubject subject];
@@ -206,6 +556,215 @@ describe(@"routing to URLs", ^{
             expect(tokens).to.equal(@[ @"united-states", @"california", @"san-francisco" ]);
         });
     });
+
+    context(@"with fan-out routes", ^{
+        __block AUTStubRoutable *masterRoutable;
+        __block AUTStubRoutable *detailRoutable;
+        __block NSMutableArray<NSString *> *handledItems;
+
+        beforeEach(^{
+            masterRoutable = [[AUTStubRoutable alloc] init];
+            detailRoutable = [[AUTStubRoutable alloc] init];
+            handledItems = [NSMutableArray array];
+
+            [masterRoutable.routes addRoute:@[ @"item", @":id" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledItems addObject:[@"master-" stringByAppendingString:parameters[@"id"]]];
+                return [RACSignal empty];
+            }];
+
+            [detailRoutable.routes addRoute:@[ @"item", @":id" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledItems addObject:[@"detail-" stringByAppendingString:parameters[@"id"]]];
+                return [RACSignal empty];
+            }];
+        });
+
+        it(@"should route each branch with the remaining components", ^{
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handledItems).to.equal((@[ @"master-1", @"detail-1" ]));
+        });
+
+        it(@"should route each branch with its own components", ^{
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[
+                    [RACSignal return:[[AUTRoutingBranch alloc] initWithRoutable:masterRoutable components:@[ @"item", @"1" ]]],
+                    [RACSignal return:[[AUTRoutingBranch alloc] initWithRoutable:detailRoutable components:@[ @"item", @"2" ]]],
+                ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handledItems).to.equal((@[ @"master-1", @"detail-2" ]));
+        });
+
+        it(@"should route branches concurrently", ^{
+            RACSubject *masterHandling = [RACSubject subject];
+
+            [masterRoutable.routes removeRoute:AUTNotNil([masterRoutable.routes routeWithIdentifier:@"item/:id"])];
+            [masterRoutable.routes addRoute:@[ @"item", @":id" ] withSignal:masterHandling];
+
+            // The master branch only completes once the detail branch is routed.
+            [detailRoutable.routes removeRoute:AUTNotNil([detailRoutable.routes routeWithIdentifier:@"item/:id"])];
+            [detailRoutable.routes addRoute:@[ @"item", @":id" ] withSignal:[RACSignal defer:^{
+                [masterHandling sendCompleted];
+                return [RACSignal empty];
+            }]];
+
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+        });
+
+        it(@"should trace the hops of each branch", ^{
+            let recorder = [[AUTRoutingTraceRecorder alloc] initWithCapacity:1];
+            router.traceRecorder = recorder;
+
+            RACSubject *masterHandling = [RACSubject subject];
+
+            [masterRoutable.routes removeRoute:AUTNotNil([masterRoutable.routes routeWithIdentifier:@"item/:id"])];
+            [masterRoutable.routes addRoute:@[ @"item", @":id" ] withSignal:masterHandling];
+
+            // The master branch is matched first, but its hop only finishes
+            // once the detail branch has been matched.
+            [detailRoutable.routes removeRoute:AUTNotNil([detailRoutable.routes routeWithIdentifier:@"item/:id"])];
+            [detailRoutable.routes addRoute:@[ @"item", @":detail_id" ] withSignal:[RACSignal defer:^{
+                [masterHandling sendCompleted];
+                return [RACSignal empty];
+            }]];
+
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            let hops = recorder.records.firstObject.hops;
+            expect(hops).to.haveCountOf(3);
+            expect(hops[0].routeComponents).to.equal(@[ @"split" ]);
+            expect(hops[1].routeComponents).to.equal((@[ @"item", @":id" ]));
+            expect(hops[2].routeComponents).to.equal((@[ @"item", @":detail_id" ]));
+        });
+
+        it(@"should error if any branch errors", ^{
+            let branchError = [NSError errorWithDomain:@"AUTRouterSpec" code:-1 userInfo:nil];
+
+            [detailRoutable.routes removeRoute:AUTNotNil([detailRoutable.routes routeWithIdentifier:@"item/:id"])];
+            [detailRoutable.routes addRoute:@[ @"item", @":id" ] withSignal:[RACSignal error:branchError]];
+
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beFalsy();
+            expect(error.domain).to.equal(AUTRoutingErrorDomain);
+            expect(error.code).to.equal(AUTRoutingErrorCodeRouteHandlerFailed);
+            expect(error.userInfo[NSUnderlyingErrorKey]).to.beIdenticalTo(branchError);
+        });
+
+        it(@"should only route to the first routable of a route that does not fan out", ^{
+            [routable.routes addRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handledItems).to.equal((@[ @"master-1" ]));
+        });
+
+        it(@"should not record a routing snapshot", ^{
+            router.recordsRoutingSnapshots = YES;
+
+            [routable.routes addFanOutRoute:@[ @"split" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                return [RACSignal merge:@[ [RACSignal return:masterRoutable], [RACSignal return:detailRoutable] ]];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/split/item/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(router.lastRoutingSnapshot).to.beNil();
+        });
+    });
+
+    context(@"with multiple roots", ^{
+        __block AUTStubRoutable *onboardingRoutable;
+        __block AUTStubRoutable *settingsRoutable;
+        __block NSMutableArray<NSString *> *handledRoots;
+
+        beforeEach(^{
+            onboardingRoutable = [[AUTStubRoutable alloc] init];
+            settingsRoutable = [[AUTStubRoutable alloc] init];
+            router = [[AUTRouter alloc] initWithRootRoutesInOrder:@[ routable.routes, onboardingRoutable.routes, settingsRoutable.routes ]];
+
+            handledRoots = [NSMutableArray array];
+
+            [routable.routes addRoute:@[ @"inbox" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledRoots addObject:@"main"];
+                return [RACSignal empty];
+            }];
+
+            [onboardingRoutable.routes addRoute:@[ @"welcome" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledRoots addObject:@"onboarding"];
+                return [RACSignal empty];
+            }];
+
+            [settingsRoutable.routes addRoute:@[ @":setting" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledRoots addObject:@"settings"];
+                return [RACSignal empty];
+            }];
+        });
+
+        it(@"should handle the first hop with the highest priority root that matches", ^{
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/welcome"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/inbox"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/privacy"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            expect(handledRoots).to.equal((@[ @"onboarding", @"main", @"settings" ]));
+        });
+
+        it(@"should match routes added to a root after routing", ^{
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/inbox"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            [onboardingRoutable.routes addRoute:@[ @"privacy" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                [handledRoots addObject:@"onboarding"];
+                return [RACSignal empty];
+            }];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/privacy"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            expect(handledRoots).to.equal((@[ @"main", @"onboarding" ]));
+        });
+
+        it(@"should error once with the reason that each root failed", ^{
+            [settingsRoutable.routes removeRoute:AUTNotNil([settingsRoutable.routes routeWithIdentifier:@":setting"])];
+
+            [onboardingRoutable.routes addRoute:@[ @"tour", @"start" ] withSignal:[RACSignal empty]];
+
+            success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/tour/end"], nil)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beFalsy();
+            expect(error.domain).to.equal(AUTRoutingErrorDomain);
+            expect(error.code).to.equal(AUTRoutingErrorCodeNoMatchFound);
+            expect(error.userInfo[AUTRoutingErrorRootFailureReasonsKey]).to.equal((@[
+                @"No route begins with tour",
+                @"No route matches tour/end",
+                @"No route begins with tour",
+            ]));
+        });
+    });
 });
 
 SpecEnd
@@ -15,7 +15,9 @@
 #import "AUTStubRoutable.h"
 
 #import <AUTRouting/AUTRouting.h>
+#import <AUTRouting/AUTRoutableConformance.h>
 #import <AUTRouting/AUTRoutes_Private.h>
+#import <AUTRouting/AUTRoutingRequest.h>
 
 SpecBegin(AUTRoutes)
 
@@ -68,6 +70,65 @@ describe(@"AUTRoutes", ^{
         });
     });
 
+    describe(@"adding routes in bulk", ^{
+        it(@"should add all unique routes and reject duplicates", ^{
+            let existingRoute = [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
+
+            let route1 = [[AUTRoute alloc] initWithComponents:@[ @"road", @"to", @":city" ] handler:emptyHandler];
+            let route2 = [[AUTRoute alloc] initWithComponents:@[ @"user", @":user_id" ] handler:emptyHandler];
+            let duplicateOfRoute1 = [[AUTRoute alloc] initWithComponents:@[ @"road", @"to", @":city" ] handler:emptyHandler];
+            let duplicateOfExistingRoute = [[AUTRoute alloc] initWithComponents:@[ @"road" ] handler:emptyHandler];
+
+            let rejectedRoutes = [routes addRoutes:@[ route1, duplicateOfExistingRoute, route2, duplicateOfRoute1 ]];
+
+            expect(rejectedRoutes).to.haveCountOf(2);
+            expect(rejectedRoutes[0]).to.beIdenticalTo(duplicateOfExistingRoute);
+            expect(rejectedRoutes[1]).to.beIdenticalTo(duplicateOfRoute1);
+
+            expect(routes.routes).to.haveCountOf(3);
+            expect(routes.routes).to.contain(existingRoute);
+            expect(routes.routes).to.contain(route1);
+            expect(routes.routes).to.contain(route2);
+        });
+
+        it(@"should replace all existing routes", ^{
+            let existingRoute = [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
+
+            let route1 = [[AUTRoute alloc] initWithComponents:@[ @"user", @":user_id" ] handler:emptyHandler];
+            let duplicateOfRoute1 = [[AUTRoute alloc] initWithComponents:@[ @"user", @":user_id" ] handler:emptyHandler];
+
+            let rejectedRoutes = [routes replaceRoutes:@[ route1, duplicateOfRoute1 ]];
+
+            expect(rejectedRoutes).to.equal(@[ duplicateOfRoute1 ]);
+            expect(routes.routes).to.haveCountOf(1);
+            expect(routes.routes).to.contain(route1);
+            expect(routes.routes).notTo.contain(existingRoute);
+        });
+
+        it(@"should not mutate previously read routes", ^{
+            [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
+            let previousRoutes = routes.routes;
+
+            [routes addRoutes:@[ [[AUTRoute alloc] initWithComponents:@[ @"user" ] handler:emptyHandler] ]];
+
+            expect(previousRoutes).to.haveCountOf(1);
+            expect(routes.routes).to.haveCountOf(2);
+        });
+
+        it(@"should not mutate routes read before routes are added or removed one at a time", ^{
+            let route = [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
+            let previousRoutes = routes.routes;
+
+            [routes addRoute:@[ @"user" ] withHandler:emptyHandler];
+            [routes removeRoute:AUTNotNil(route)];
+
+            expect(previousRoutes).to.haveCountOf(1);
+            expect(previousRoutes).to.contain(route);
+            expect(routes.routes).to.haveCountOf(1);
+            expect(routes.routes).notTo.contain(route);
+        });
+    });
+
     describe(@"route removal", ^{
         it(@"should remove a previously added route", ^{
             expect(routes.routes).to.haveCountOf(0);
@@ -91,11 +152,51 @@ describe(@"AUTRoutes", ^{
         });
     });
 
+    it(@"should share storage for identical components across routes", ^{
+        let component1 = [NSString stringWithFormat:@"%@", @"settings"];
+        let component2 = [NSString stringWithFormat:@"%@", @"settings"];
+        expect(component1).notTo.beIdenticalTo(component2);
+
+        let route1 = [routes addRoute:@[ component1, @"detail" ] withHandler:emptyHandler];
+        let route2 = [routes addRoute:@[ component2 ] withHandler:emptyHandler];
+
+        expect(route1.components.firstObject).to.beIdenticalTo(route2.components.firstObject);
+    });
+
+    it(@"should not match components that were never part of a route", ^{
+        [routes addRoute:@[ @"road", @":city" ] withHandler:emptyHandler];
+
+        expect([routes canHandleComponents:@[ @"road", @"unregistered-component" ] URL:[NSURL URLWithString:@"custom:/road/unregistered-component"]]).to.beTruthy();
+        expect([routes canHandleComponents:@[ @"unregistered-component" ] URL:[NSURL URLWithString:@"custom:/unregistered-component"]]).to.beFalsy();
+    });
+
     it(@"should report if it can handle the given components", ^{
         [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
 
-        expect([routes canHandleComponents:@[@"road"]]).to.beTruthy();
-        expect([routes canHandleComponents:@[@"location"]]).to.beFalsy();
+        expect([routes canHandleComponents:@[ @"road" ] URL:[NSURL URLWithString:@"custom:/road"]]).to.beTruthy();
+        expect([routes canHandleComponents:@[ @"location" ] URL:[NSURL URLWithString:@"custom:/location"]]).to.beFalsy();
+    });
+
+    it(@"should only report that it can handle components if required query keys are present", ^{
+        [routes addRoute:@[ @"inbox", @"?tab" ] withHandler:emptyHandler];
+
+        expect([routes canHandleComponents:@[ @"inbox" ] URL:[NSURL URLWithString:@"custom:/inbox?tab=2"]]).to.beTruthy();
+        expect([routes canHandleComponents:@[ @"inbox" ] URL:[NSURL URLWithString:@"custom:/inbox"]]).to.beFalsy();
+        expect(routes.routeStatistics[0].nearMissCount).to.equal(0);
+    });
+
+    it(@"should match components with more segments than fit on the stack", ^{
+        [routes addRoute:@[ @"road", @":city" ] withHandler:emptyHandler];
+
+        let components = [NSMutableArray<NSString *> arrayWithObject:@"road"];
+        for (NSUInteger index = 0; index < 100000; index++) {
+            [components addObject:@"city"];
+        }
+
+        NSInteger matchLength = 0;
+        let route = [routes matchingRouteForComponents:components request:nil matchLength:&matchLength];
+        expect(route.identifier).to.equal(@"road/:city");
+        expect(matchLength).to.equal(2);
     });
 
     describe(@"route handling", ^{
@@ -188,6 +289,22 @@ describe(@"AUTRoutes", ^{
                 let selectedParameter = [handledParameter asynchronousFirstOrDefault:nil success:&success error:&error];
                 expect(selectedParameter).to.equal(@"berlin");
             });
+
+            it(@"should place the token ahead of query keys", ^{
+                let route = [routes addRoute:@[ @"inbox", @"?tab" ] withSingleTokenHandler:^(NSString *parameter, NSURL *url) {
+                    [handledParameter sendNext:parameter];
+                    return [RACSignal empty];
+                }];
+                expect(route.components).to.equal((@[ @"inbox", @":single-token", @"?tab" ]));
+
+                let url = [NSURL URLWithString:@"https://inbox/archive?tab=2"];
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+
+                [handledParameter sendCompleted];
+                let selectedParameter = [handledParameter asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(selectedParameter).to.equal(@"archive");
+            });
         });
 
         context(@"with a signal", ^{
@@ -222,6 +339,133 @@ describe(@"AUTRoutes", ^{
             });
         });
 
+        context(@"with query keys", ^{
+            __block RACSubject<NSDictionary<NSString *, NSString *> *> *handledParameters;
+
+            beforeEach(^{
+                handledParameters = [RACReplaySubject subject];
+
+                [routes addRoute:@[ @"inbox", @":folder", @"?tab", @"?[ref]" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                    [handledParameters sendNext:parameters];
+                    return [RACSignal empty];
+                }];
+            });
+
+            it(@"should pass query values alongside token values", ^{
+                let url = [NSURL URLWithString:@"https://inbox/archive?tab=2&ref=push&unused=1"];
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+
+                let parameters = [handledParameters asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(parameters).to.equal((@{ @"folder": @"archive", @"tab": @"2", @"ref": @"push" }));
+            });
+
+            it(@"should not require optional query keys", ^{
+                let url = [NSURL URLWithString:@"https://inbox/archive?tab=2"];
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+
+                let parameters = [handledParameters asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(parameters).to.equal((@{ @"folder": @"archive", @"tab": @"2" }));
+            });
+
+            it(@"should not match if a required query key is missing", ^{
+                let url = [NSURL URLWithString:@"https://inbox/archive?ref=push"];
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beFalsy();
+                expect(error.code).to.equal(AUTRoutingErrorCodeNoMatchFound);
+            });
+
+            it(@"should fall back to a route without query keys if a required query key is missing", ^{
+                [routes addRoute:@[ @"inbox", @":folder" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                    [handledParameters sendNext:@{}];
+                    return [RACSignal empty];
+                }];
+
+                let url = [NSURL URLWithString:@"https://inbox/archive"];
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+
+                let parameters = [handledParameters asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(parameters).to.equal(@{});
+            });
+        });
+
+        context(@"with a fallback handler", ^{
+            beforeEach(^{
+                [routes addRoute:@[ @"city" ] withSignal:[RACSignal empty]];
+
+                routes.fallbackHandler = ^(NSArray<NSString *> *components, id context, NSURL *url) {
+                    return [RACSignal return:routable];
+                };
+            });
+
+            it(@"should send the fallback routable with no remaining components when no route matches", ^{
+                let url = [NSURL URLWithString:@"https://road/to/nowhere"];
+                let componentsAndRoutable = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(success).to.beTruthy();
+                expect(componentsAndRoutable.first).to.beIdenticalTo(routable);
+                expect(componentsAndRoutable.last).to.equal(@[]);
+            });
+        });
+
+        context(@"with an idempotent route", ^{
+            __block NSUInteger handlerInvocations;
+            __block AUTRoute *route;
+
+            beforeEach(^{
+                handlerInvocations = 0;
+
+                route = [routes addIdempotentRoute:@[ @"tab", @":name" ] cachedRoutableLifetime:0 withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+                    handlerInvocations++;
+                    return [RACSignal return:routable];
+                }];
+            });
+
+            it(@"should send the cached routable without invoking the handler for the same parameters", ^{
+                let url = [NSURL URLWithString:@"https://tab/home/settings"];
+
+                [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                let componentsAndRoutable = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronousFirstOrDefault:nil success:&success error:&error];
+
+                expect(handlerInvocations).to.equal(1);
+                expect(componentsAndRoutable.first).to.beIdenticalTo(routable);
+                expect(componentsAndRoutable.last).to.equal(@[ @"settings" ]);
+            });
+
+            it(@"should invoke the handler for different parameters", ^{
+                let homeURL = [NSURL URLWithString:@"https://tab/home"];
+                let searchURL = [NSURL URLWithString:@"https://tab/search"];
+
+                [[routes handleComponents:homeURL.aut_routingComponents context:nil URL:homeURL] asynchronouslyWaitUntilCompleted:&error];
+                [[routes handleComponents:searchURL.aut_routingComponents context:nil URL:searchURL] asynchronouslyWaitUntilCompleted:&error];
+
+                expect(handlerInvocations).to.equal(2);
+            });
+
+            it(@"should invoke the handler again once the cached routable expires", ^{
+                route.cachedRoutableLifetime = 0.01;
+
+                let url = [NSURL URLWithString:@"https://tab/home"];
+                [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+
+                [NSThread sleepForTimeInterval:0.02];
+                [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+
+                expect(handlerInvocations).to.equal(2);
+            });
+
+            it(@"should invoke the handler again once the cached routables are removed", ^{
+                let url = [NSURL URLWithString:@"https://tab/home"];
+                [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+
+                [route removeCachedRoutables];
+                [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+
+                expect(handlerInvocations).to.equal(2);
+            });
+        });
+
         context(@"with a context class", ^{
             __block RACSubject<NSNumber *> *handledContext;
 
@@ -262,6 +506,57 @@ describe(@"AUTRoutes", ^{
                 expect(success).to.beTruthy();
             });
             
+            it(@"should dispatch to the handler for the context object's class", ^{
+                __block NSString *handledString;
+
+                let route = [routes addRoute:@[ @"road" ] withContextClass:NSString.class handler:^(NSDictionary *parameters, NSString *context, NSURL *url) {
+                    handledString = context;
+                    return [RACSignal empty];
+                }];
+                expect(route).notTo.beNil();
+                expect(routes.routes).to.haveCountOf(1);
+
+                let url = [NSURL URLWithString:@"https://road"];
+                success = [[routes handleComponents:url.aut_routingComponents context:[@"1" mutableCopy] URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+                expect(handledString).to.equal(@"1");
+
+                success = [[routes handleComponents:url.aut_routingComponents context:@2 URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+
+                let selectedContext = [handledContext asynchronousFirstOrDefault:nil success:&success error:&error];
+                expect(selectedContext).to.equal(@2);
+            });
+
+            it(@"should not add a second handler for the same context class", ^{
+                let route = [routes addRoute:@[ @"road" ] withContextClass:NSNumber.class handler:^(NSDictionary *parameters, NSNumber *context, NSURL *url) {
+                    return [RACSignal empty];
+                }];
+                expect(route).to.beNil();
+            });
+
+            it(@"should merge handlers registered concurrently for different context classes", ^{
+                let contextClasses = @[ NSString.class, NSArray.class, NSDictionary.class, NSDate.class, NSData.class, NSURL.class, NSSet.class, NSUUID.class ];
+                let addedRoutes = [NSMutableArray<AUTRoute *> array];
+
+                dispatch_apply(contextClasses.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t index) {
+                    let route = [routes addRoute:@[ @"road" ] withContextClass:contextClasses[index] handler:^(NSDictionary *parameters, id context, NSURL *url) {
+                        return [RACSignal empty];
+                    }];
+
+                    @synchronized (addedRoutes) {
+                        if (route != nil) [addedRoutes addObject:AUTNotNil(route)];
+                    }
+                });
+
+                expect(addedRoutes).to.haveCountOf(contextClasses.count);
+                expect(routes.routes).to.haveCountOf(1);
+
+                let url = [NSURL URLWithString:@"https://road"];
+                success = [[routes handleComponents:url.aut_routingComponents context:[NSUUID UUID] URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+            });
+
             it(@"should fail when the context object is nil", ^{
                 let url = [NSURL URLWithString:@"https://road"];
                 success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
@@ -277,6 +572,313 @@ describe(@"AUTRoutes", ^{
             });
         });
     });
+
+    describe(@"route statistics", ^{
+        __block AUTRoute *userRoute;
+        __block AUTRoute *postRoute;
+
+        beforeEach(^{
+            userRoute = [routes addRoute:@[ @"user", @":user_id" ] withHandler:emptyHandler];
+            postRoute = [routes addRoute:@[ @"user", @":user_id", @"posts", @":post_id" ] withHandler:emptyHandler];
+        });
+
+        it(@"should count hits and near misses", ^{
+            for (NSString *URLString in @[ @"custom:/user/1", @"custom:/user/2", @"custom:/user/1/posts/3", @"custom:/user/1/likes/4" ]) {
+                let url = AUTNotNil([NSURL URLWithString:URLString]);
+                success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+                expect(success).to.beTruthy();
+            }
+
+            let statistics = routes.routeStatistics;
+            expect(statistics).to.haveCountOf(2);
+
+            expect(statistics[0].routeIdentifier).to.equal(userRoute.identifier);
+            expect(statistics[0].hitCount).to.equal(3);
+            expect(statistics[0].nearMissCount).to.equal(0);
+
+            expect(statistics[1].routeIdentifier).to.equal(postRoute.identifier);
+            expect(statistics[1].hitCount).to.equal(1);
+            expect(statistics[1].nearMissCount).to.equal(1);
+            expect(statistics[1].handlerDuration).to.beGreaterThanOrEqualTo(0);
+        });
+
+        it(@"should not count matches without routing", ^{
+            expect([routes canHandleComponents:@[ @"user", @"1", @"likes", @"4" ] URL:[NSURL URLWithString:@"custom:/user/1/likes/4"]]).to.beTruthy();
+            expect(routes.routeStatistics[0].hitCount).to.equal(0);
+            expect(routes.routeStatistics[1].nearMissCount).to.equal(0);
+        });
+
+        it(@"should export statistics as JSON objects", ^{
+            let url = AUTNotNil([NSURL URLWithString:@"custom:/user/1"]);
+            success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            let JSONObject = routes.routeStatisticsJSONObject;
+            expect([NSJSONSerialization isValidJSONObject:JSONObject]).to.beTruthy();
+            expect(JSONObject.firstObject[@"route"]).to.equal(@"user/:user_id");
+            expect(JSONObject.firstObject[@"hits"]).to.equal(@1);
+        });
+
+        it(@"should reset statistics", ^{
+            let url = AUTNotNil([NSURL URLWithString:@"custom:/user/1"]);
+            success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            [routes resetRouteStatistics];
+
+            expect(routes.routeStatistics[0].hitCount).to.equal(0);
+        });
+
+        it(@"should select the same routes when ordering routes by hits", ^{
+            [routes addRoute:@[ @"user", @"me" ] withHandler:emptyHandler];
+            [routes addRoute:@[ @":anything" ] withHandler:emptyHandler];
+            [routes addRoute:@[ @"inbox", @"?tab" ] withHandler:emptyHandler];
+            [routes addRoute:@[ @"inbox" ] withHandler:emptyHandler];
+
+            let URLStrings = @[ @"custom:/user/me", @"custom:/user/1", @"custom:/user/1/posts/2", @"custom:/inbox?tab=1", @"custom:/inbox", @"custom:/other" ];
+
+            let selectedRoutes = ^{
+                let selectedRoutes = [NSMutableArray array];
+
+                for (NSString *URLString in URLStrings) {
+                    let url = AUTNotNil([NSURL URLWithString:URLString]);
+                    let request = [[AUTRoutingRequest alloc] initWithURL:url context:nil interceptors:nil];
+                    [selectedRoutes addObject:[routes matchingRouteForComponents:url.aut_routingComponents request:request matchLength:NULL] ?: NSNull.null];
+
+                    success = [[routes handleComponents:url.aut_routingComponents request:request] asynchronouslyWaitUntilCompleted:&error];
+                    expect(success).to.beTruthy();
+                }
+
+                return [selectedRoutes copy];
+            };
+
+            let unorderedRoutes = selectedRoutes();
+            expect(unorderedRoutes[0]).to.equal([routes routeWithIdentifier:@"user/me"]);
+            expect(unorderedRoutes[3]).to.equal([routes routeWithIdentifier:@"inbox/?tab"]);
+
+            routes.ordersRoutesByHits = YES;
+
+            // Route once to order the routes by hits, and again with them
+            // ordered.
+            expect(selectedRoutes()).to.equal(unorderedRoutes);
+            expect(selectedRoutes()).to.equal(unorderedRoutes);
+        });
+    });
+
+    describe(@"owner-scoped routes", ^{
+        it(@"should remove a route when its owner deallocates", ^{
+            @autoreleasepool {
+                let owner = [[NSObject alloc] init];
+
+                expect([routes addRoute:@[ @"road" ] owner:owner withHandler:emptyHandler]).notTo.beNil();
+                expect([routes addRoute:@[ @"user", @":user_id" ] owner:owner withHandler:emptyHandler]).notTo.beNil();
+                [routes addRoute:@[ @"inbox" ] withHandler:emptyHandler];
+
+                expect(routes.routes).to.haveCountOf(3);
+                expect(routes.memoryUsage.ownedRouteCount).to.equal(2);
+            }
+
+            expect(routes.routes).to.haveCountOf(1);
+            expect(routes.memoryUsage.ownedRouteCount).to.equal(0);
+        });
+
+        it(@"should not remove an equal route that replaced an owned route", ^{
+            AUTRoute *replacementRoute;
+
+            @autoreleasepool {
+                let owner = [[NSObject alloc] init];
+
+                let route = [routes addRoute:@[ @"road" ] owner:owner withHandler:emptyHandler];
+                [routes removeRoute:AUTNotNil(route)];
+
+                replacementRoute = [routes addRoute:@[ @"road" ] withHandler:emptyHandler];
+            }
+
+            expect(routes.routes).to.haveCountOf(1);
+            expect(routes.routes.anyObject).to.beIdenticalTo(replacementRoute);
+        });
+
+        it(@"should remove a command route when its owner deallocates", ^{
+            let command = [[RACCommand alloc] initWithSignalBlock:^(id _) {
+                return [RACSignal empty];
+            }];
+
+            @autoreleasepool {
+                let owner = [[NSObject alloc] init];
+
+                expect([command aut_execute:nil whenRoutes:routes handleRoute:@[ @"road" ] owner:owner]).notTo.beNil();
+                expect(routes.routes).to.haveCountOf(1);
+            }
+
+            expect(routes.routes).to.haveCountOf(0);
+        });
+    });
+
+    describe(@"command routes", ^{
+        let url = [NSURL URLWithString:@"custom:/road/to/berlin"];
+
+        it(@"should send the first routable of the execution and its remaining components", ^{
+            let command = [[RACCommand alloc] initWithSignalBlock:^(id _) {
+                // Never completes, like a presentation that lasts as long as
+                // the presented screen.
+                return [[RACSignal return:routable] concat:[RACSignal never]];
+            }];
+
+            [command aut_execute:nil whenRoutes:routes handleRoute:@[ @"road" ]];
+
+            RACTuple *tuple = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(tuple.first).to.beIdenticalTo(routable);
+            expect(tuple.second).to.equal((@[ @"to", @"berlin" ]));
+        });
+
+        it(@"should end routing if the first value of the execution is not routable", ^{
+            let command = [[RACCommand alloc] initWithSignalBlock:^(id _) {
+                return [RACSignal return:@"not routable"];
+            }];
+
+            [command aut_execute:nil whenRoutes:routes handleRoute:@[ @"road" ]];
+
+            let values = [[[routes handleComponents:url.aut_routingComponents context:nil URL:url] collect] asynchronousFirstOrDefault:nil success:&success error:&error];
+            expect(success).to.beTruthy();
+            expect(values).to.haveCountOf(0);
+        });
+
+        it(@"should cache the conformance of each class", ^{
+            expect(AUTIsRoutable(routable)).to.beTruthy();
+            expect(AUTIsRoutable(routable)).to.beTruthy();
+            expect(AUTIsRoutable([[AUTStubRoutable alloc] init])).to.beTruthy();
+            expect(AUTIsRoutable(@"not routable")).to.beFalsy();
+            expect(AUTIsRoutable(@"not routable")).to.beFalsy();
+            expect(AUTIsRoutable(nil)).to.beFalsy();
+        });
+    });
+
+    describe(@"memory usage", ^{
+        it(@"should account for route segments and caches", ^{
+            let route = [routes addIdempotentRoute:@[ @"road", @":city" ] cachedRoutableLifetime:0 withHandler:^(NSDictionary *parameters, NSURL *url) {
+                return [RACSignal return:routable];
+            }];
+            expect(route).notTo.beNil();
+
+            let emptyUsage = routes.memoryUsage;
+            expect(emptyUsage.routeCount).to.equal(1);
+            expect(emptyUsage.segmentByteCount).to.beGreaterThan(0);
+
+            let url = AUTNotNil([NSURL URLWithString:@"custom:/road/berlin"]);
+            success = [[routes handleComponents:url.aut_routingComponents context:nil URL:url] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+
+            expect([route URLWithScheme:@"custom" parameters:@{ @"city": @"berlin" }]).notTo.beNil();
+
+            let usage = routes.memoryUsage;
+            expect(usage.segmentByteCount).to.equal(emptyUsage.segmentByteCount);
+            expect(usage.cacheByteCount).to.beGreaterThan(emptyUsage.cacheByteCount);
+
+            [routes purgeCaches];
+
+            expect(routes.memoryUsage.cacheByteCount).to.equal(emptyUsage.cacheByteCount);
+        });
+
+        it(@"should purge caches on memory pressure when enabled", ^{
+            let route = [routes addRoute:@[ @"road", @":city" ] withHandler:emptyHandler];
+            expect([route URLWithScheme:@"custom" parameters:@{ @"city": @"berlin" }]).notTo.beNil();
+
+            let cacheByteCount = routes.memoryUsage.cacheByteCount;
+            expect(cacheByteCount).to.beGreaterThan(0);
+
+            [AUTRoutes handleMemoryPressure];
+            expect(routes.memoryUsage.cacheByteCount).to.equal(cacheByteCount);
+
+            routes.purgesCachesOnMemoryPressure = YES;
+            [AUTRoutes handleMemoryPressure];
+            expect(routes.memoryUsage.cacheByteCount).to.equal(0);
+
+            routes.purgesCachesOnMemoryPressure = NO;
+        });
+    });
+
+    describe(@"reverse routing", ^{
+        __block NSDictionary<NSString *, NSString *> *handledParameters;
+        __block AUTRoute *route;
+
+        beforeEach(^{
+            handledParameters = nil;
+
+            route = [routes addRoute:@[ @"user", @":user_id", @"posts", @"?tab", @"?[ref]" ] withHandler:^(NSDictionary *parameters, NSURL *url) {
+                handledParameters = parameters;
+                return [RACSignal empty];
+            }];
+        });
+
+        it(@"should generate a URL from a route", ^{
+            let url = [route URLWithScheme:@"custom" parameters:@{ @"user_id": @"1234", @"tab": @"2" }];
+            expect(url).to.equal([NSURL URLWithString:@"custom:/user/1234/posts?tab=2"]);
+        });
+
+        it(@"should generate a URL from a route with a long static component", ^{
+            let component = [@"" stringByPaddingToLength:2000 withString:@"a b" startingAtIndex:0];
+            let longRoute = [routes addRoute:@[ component, @":id" ] withHandler:^(NSDictionary *parameters, NSURL *url) {
+                return [RACSignal empty];
+            }];
+
+            let url = [longRoute URLWithScheme:@"custom" parameters:@{ @"id": @"1" }];
+            let encodedComponent = [component stringByReplacingOccurrencesOfString:@" " withString:@"%20"];
+            expect(url.absoluteString).to.equal([NSString stringWithFormat:@"custom:/%@/1", encodedComponent]);
+        });
+
+        it(@"should generate a URL from a route identifier", ^{
+            expect(route.identifier).to.equal(@"user/:user_id/posts/?tab/?[ref]");
+            expect([routes routeWithIdentifier:route.identifier]).to.beIdenticalTo(route);
+
+            let url = [routes URLForRouteWithIdentifier:route.identifier scheme:@"custom" parameters:@{ @"user_id": @"1234", @"tab": @"2", @"ref": @"push" }];
+            expect(url).to.equal([NSURL URLWithString:@"custom:/user/1234/posts?tab=2&ref=push"]);
+
+            expect([routes URLForRouteWithIdentifier:@"user" scheme:@"custom" parameters:@{}]).to.beNil();
+        });
+
+        it(@"should look up routes by identifier as they are added and removed", ^{
+            expect([routes routeWithIdentifier:@"settings"]).to.beNil();
+
+            let settingsRoute = [routes addRoute:@[ @"settings" ] withHandler:^(NSDictionary *parameters, NSURL *url) {
+                return [RACSignal empty];
+            }];
+            expect([routes routeWithIdentifier:@"settings"]).to.beIdenticalTo(settingsRoute);
+
+            [routes removeRoute:AUTNotNil(settingsRoute)];
+            expect([routes routeWithIdentifier:@"settings"]).to.beNil();
+            expect([routes routeWithIdentifier:route.identifier]).to.beIdenticalTo(route);
+        });
+
+        it(@"should not generate a URL that is missing required parameters", ^{
+            expect([route URLWithScheme:@"custom" parameters:@{ @"tab": @"2" }]).to.beNil();
+            expect([route URLWithScheme:@"custom" parameters:@{ @"user_id": @"", @"tab": @"2" }]).to.beNil();
+            expect([route URLWithScheme:@"custom" parameters:@{ @"user_id": @"1234" }]).to.beNil();
+        });
+
+        it(@"should round trip parameters that require encoding", ^{
+            let parameters = @{
+                @"user_id": @"a/b;c d%é?",
+                @"tab": @"x&y=z+#",
+                @"ref": @"",
+            };
+
+            let url = [route URLWithScheme:@"custom" parameters:parameters];
+            expect(url).notTo.beNil();
+            expect(url.aut_routingComponents).to.equal((@[ @"user", @"a/b;c d%é?", @"posts" ]));
+
+            success = [[routes handleComponents:url.aut_routingComponents context:nil URL:AUTNotNil(url)] asynchronouslyWaitUntilCompleted:&error];
+            expect(success).to.beTruthy();
+            expect(handledParameters).to.equal(parameters);
+        });
+
+        it(@"should generate a URL that is routed through many routes", ^{
+            let tabRoute = [routes addRoute:@[ @"tabs", @":tab_id" ] withHandler:emptyHandler];
+
+            let url = [AUTRoute URLWithScheme:@"custom" routes:@[ tabRoute, route ] parameters:@{ @"tab_id": @"home", @"user_id": @"1234", @"tab": @"2" }];
+            expect(url).to.equal([NSURL URLWithString:@"custom:/tabs/home/user/1234/posts?tab=2"]);
+        });
+    });
 });
 
 SpecEnd
@@ -0,0 +1,111 @@
+//
+//  AUTRoutingIntrospectionSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+
+SpecBegin(AUTRoutingIntrospection)
+
+__block AUTRoutes *routes;
+__block AUTRouteWithoutContextHandlerBlock emptyHandler;
+
+beforeEach(^{
+    routes = [[AUTRoutes alloc] init];
+
+    emptyHandler = ^(NSDictionary *parameters, NSURL *url) {
+        return [RACSignal empty];
+    };
+
+    [routes addRoute:@[ @"user", @":user_id" ] withHandler:emptyHandler];
+    [routes addRoute:@[ @"user", @":id" ] withHandler:emptyHandler];
+    [routes addRoute:@[ @"user", @"me" ] withHandler:emptyHandler];
+    [routes addRoute:@[ @"inbox", @"?tab" ] withContextClass:NSString.class handler:^(NSDictionary *parameters, id context, NSURL *url) {
+        return [RACSignal empty];
+    }];
+});
+
+describe(@"exporting JSON", ^{
+    __block NSDictionary<NSString *, id> *JSONObject;
+
+    beforeEach(^{
+        JSONObject = routes.introspectionJSONObject;
+    });
+
+    it(@"should be serializable", ^{
+        expect([NSJSONSerialization isValidJSONObject:JSONObject]).to.beTruthy();
+        expect(JSONObject[@"orders_routes_by_hits"]).to.equal(@NO);
+    });
+
+    it(@"should list nodes and edges", ^{
+        let nodes = (NSArray<NSDictionary<NSString *, id> *> *)JSONObject[@"nodes"];
+        let edges = (NSArray<NSDictionary<NSString *, id> *> *)JSONObject[@"edges"];
+
+        // The root, "inbox", "user", "user/me" and "user/:"
+        expect(nodes).to.haveCountOf(5);
+        expect(nodes[0][@"fanout"]).to.equal(@2);
+        expect(nodes[2][@"ambiguous"]).to.equal(@YES);
+
+        expect(edges).to.haveCountOf(4);
+        expect(edges[0]).to.equal((@{ @"from": @0, @"to": @1, @"kind": @"static", @"segment": @"inbox" }));
+        expect(edges[3]).to.equal((@{ @"from": @2, @"to": @4, @"kind": @"token", @"keys": @[ @"id", @"user_id" ] }));
+    });
+
+    it(@"should describe routes", ^{
+        let routeObjects = (NSArray<NSDictionary<NSString *, id> *> *)JSONObject[@"routes"];
+        expect(routeObjects).to.haveCountOf(4);
+
+        expect(routeObjects[0][@"id"]).to.equal(@"inbox/?tab");
+        expect(routeObjects[0][@"node"]).to.equal(@1);
+        expect(routeObjects[0][@"required_query_keys"]).to.equal(@[ @"tab" ]);
+        expect(routeObjects[0][@"context_classes"]).to.equal(@[ @"NSString" ]);
+        expect(routeObjects[0][@"hits"]).to.equal(@0);
+    });
+
+    it(@"should identify shadowed routes", ^{
+        let routeObjects = (NSArray<NSDictionary<NSString *, id> *> *)JSONObject[@"routes"];
+
+        expect(routeObjects[1][@"id"]).to.equal(@"user/:id");
+        expect(routeObjects[1][@"shadowed_by"]).to.beNil();
+
+        expect(routeObjects[2][@"id"]).to.equal(@"user/:user_id");
+        expect(routeObjects[2][@"shadowed_by"]).to.equal(@"user/:id");
+    });
+});
+
+describe(@"exporting DOT", ^{
+    it(@"should describe the edges of the routes", ^{
+        let DOTString = routes.introspectionDOTString;
+
+        expect(DOTString).to.beginWith(@"digraph routes {");
+        expect(DOTString).to.contain(@"n0 -> n2 [label=\"user\"];");
+        expect(DOTString).to.contain(@"n2 -> n4 [label=\":id | :user_id\", style=dashed];");
+        expect(DOTString).to.contain(@"color=red");
+    });
+});
+
+describe(@"introspecting a router", ^{
+    it(@"should include its root routes and traced routes", ^{
+        let router = [[AUTRouter alloc] initWithRootRoutes:routes];
+        router.traceRecorder = [[AUTRoutingTraceRecorder alloc] initWithCapacity:10];
+
+        let url = AUTNotNil([NSURL URLWithString:@"custom:/user/me"]);
+
+        BOOL success = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronouslyWaitUntilCompleted:NULL];
+        expect(success).to.beTruthy();
+
+        let JSONObject = router.introspectionJSONObject;
+        expect([NSJSONSerialization isValidJSONObject:JSONObject]).to.beTruthy();
+        expect(JSONObject[@"root"]).to.equal(routes.introspectionJSONObject);
+        expect(JSONObject[@"traced_routes"][0][@"route"]).to.equal(@"user/me");
+        expect(JSONObject[@"traced_routes"][0][@"matches"]).to.equal(@1);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,84 @@
+//
+//  AUTRoutingLoadGenerator.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <AUTRouting/AUTRouting.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Maps a uniformly distributed random value in [0, 1) to a handler latency,
+/// i.e. the inverse of the cumulative distribution function of the latencies.
+typedef NSTimeInterval (^AUTRoutingLoadLatencyDistribution)(double uniform);
+
+/// The outcome of a load run.
+@interface AUTRoutingLoadResult : NSObject
+
+/// The number of URLs that were routed to.
+@property (readonly, nonatomic) NSUInteger routingCount;
+
+/// The number of URLs that failed to route.
+@property (readonly, nonatomic) NSUInteger failureCount;
+
+/// The wall-clock time of the run.
+@property (readonly, nonatomic) NSTimeInterval duration;
+
+/// The number of URLs routed to per second across all threads.
+@property (readonly, nonatomic) double throughput;
+
+/// Percentiles of the time taken to route to a single URL.
+@property (readonly, nonatomic) NSTimeInterval latencyP50;
+@property (readonly, nonatomic) NSTimeInterval latencyP99;
+@property (readonly, nonatomic) NSTimeInterval latencyP999;
+
+/// The number of heap allocations made per routed URL. Counts every
+/// allocation in the process during the run, so it is an upper bound.
+@property (readonly, nonatomic) double allocationsPerRouting;
+
+@end
+
+/// Builds a random routing tree and pushes random URLs through AUTRouter to
+/// measure how it scales.
+///
+/// Each thread's router matches and invokes handlers on a background scheduler
+/// of its own, so that routing never waits on the main thread.
+///
+/// Routing trees, URLs and handler latencies are derived from the seed, so
+/// runs with the same configuration are comparable across changes.
+@interface AUTRoutingLoadGenerator : NSObject
+
+/// The number of routables from the root to the leaves of the tree, including
+/// both. Must be greater than one. Defaults to 3.
+@property (nonatomic) NSUInteger depth;
+
+/// The number of routes of each routable that isn't a leaf. Defaults to 8.
+@property (nonatomic) NSUInteger fanout;
+
+/// The fraction of routes whose pattern is a single static component. The
+/// remaining routes have a token component following their static component.
+/// Defaults to 0.5.
+@property (nonatomic) double staticRatio;
+
+/// The distribution of the time each route handler takes to send its next
+/// routable, or nil for handlers that send synchronously. Defaults to nil.
+@property (nonatomic, copy, nullable) AUTRoutingLoadLatencyDistribution handlerLatency;
+
+/// The number of distinct URLs that are generated. Defaults to 1000.
+@property (nonatomic) NSUInteger URLCount;
+
+/// The number of threads that the URLs are routed to from, each with its own
+/// router over the shared tree. Defaults to 1.
+@property (nonatomic) NSUInteger threadCount;
+
+/// The seed of the random tree and URLs. Defaults to 1.
+@property (nonatomic) uint64_t seed;
+
+/// Builds the tree and routes to each of the URLs from every thread, blocking
+/// until finished.
+- (AUTRoutingLoadResult *)run;
+
+@end
+
+NS_ASSUME_NONNULL_END
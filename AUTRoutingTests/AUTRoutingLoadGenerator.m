@@ -0,0 +1,333 @@
+//
+//  AUTRoutingLoadGenerator.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <stdatomic.h>
+
+#import <AUTRouting/AUTRouter_Private.h>
+#import <AUTRouting/AUTRoutingTime.h>
+
+#import "AUTExtObjC.h"
+#import "AUTStubRoutable.h"
+
+#import "AUTRoutingLoadGenerator.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Allocation counting
+
+/// The signature of libmalloc's logging hook, which is invoked for every
+/// allocation and deallocation in the process while set.
+typedef void (MallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numHotFramesToSkip);
+extern MallocLogger *malloc_logger;
+
+/// Set by libmalloc in the type of allocation events.
+static const uint32_t MallocLogTypeAllocate = 2;
+
+static atomic_ullong AllocationCount;
+static MallocLogger *PreviousMallocLogger;
+
+static void CountingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numHotFramesToSkip) {
+    if ((type & MallocLogTypeAllocate) != 0) {
+        atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+    }
+
+    if (PreviousMallocLogger != NULL) {
+        PreviousMallocLogger(type, arg1, arg2, arg3, result, numHotFramesToSkip + 1);
+    }
+}
+
+static void StartCountingAllocations(void) {
+    atomic_store(&AllocationCount, 0);
+    PreviousMallocLogger = malloc_logger;
+    malloc_logger = CountingMallocLogger;
+}
+
+static unsigned long long StopCountingAllocations(void) {
+    malloc_logger = PreviousMallocLogger;
+    PreviousMallocLogger = NULL;
+    return atomic_load(&AllocationCount);
+}
+
+#pragma mark - Random numbers
+
+/// Returns the next value of a xorshift64* generator with the provided state.
+static uint64_t NextRandom(uint64_t *state) {
+    var x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/// Scrambles the provided value with the splitmix64 finalizer, so that nearby
+/// values give unrelated generator states.
+static uint64_t MixRandom(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/// Returns a uniformly distributed value in [0, 1).
+static double NextUniform(uint64_t *state) {
+    return (NextRandom(state) >> 11) * 0x1.0p-53;
+}
+
+#pragma mark - Percentiles
+
+static int CompareTimeIntervals(const void *a, const void *b) {
+    let lhs = *(const NSTimeInterval *)a;
+    let rhs = *(const NSTimeInterval *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/// Returns the nearest-rank percentile of the provided sorted values.
+static NSTimeInterval Percentile(const NSTimeInterval *sortedValues, NSUInteger count, double percentile) {
+    if (count == 0) return 0;
+
+    let rank = (NSUInteger)ceil(percentile * count);
+    return sortedValues[MIN(MAX(rank, 1), count) - 1];
+}
+
+/// A routable in the generated tree, which remembers its routes in the order
+/// that they were added so that URLs can be generated deterministically.
+@interface AUTRoutingLoadRoutable : AUTStubRoutable
+
+@property (readonly, nonatomic) NSMutableArray<NSArray<NSString *> *> *routeComponents;
+@property (readonly, nonatomic) NSMutableArray<AUTRoutingLoadRoutable *> *nextRoutables;
+
+@end
+
+@implementation AUTRoutingLoadRoutable
+
+- (instancetype)init {
+    self = [super init];
+
+    _routeComponents = [NSMutableArray array];
+    _nextRoutables = [NSMutableArray array];
+
+    return self;
+}
+
+@end
+
+@interface AUTRoutingLoadResult ()
+
+- (instancetype)initWithRoutingCount:(NSUInteger)routingCount failureCount:(NSUInteger)failureCount duration:(NSTimeInterval)duration latencyP50:(NSTimeInterval)latencyP50 latencyP99:(NSTimeInterval)latencyP99 latencyP999:(NSTimeInterval)latencyP999 allocationsPerRouting:(double)allocationsPerRouting NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation AUTRoutingLoadResult
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRoutingCount:(NSUInteger)routingCount failureCount:(NSUInteger)failureCount duration:(NSTimeInterval)duration latencyP50:(NSTimeInterval)latencyP50 latencyP99:(NSTimeInterval)latencyP99 latencyP999:(NSTimeInterval)latencyP999 allocationsPerRouting:(double)allocationsPerRouting {
+    self = [super init];
+
+    _routingCount = routingCount;
+    _failureCount = failureCount;
+    _duration = duration;
+    _latencyP50 = latencyP50;
+    _latencyP99 = latencyP99;
+    _latencyP999 = latencyP999;
+    _allocationsPerRouting = allocationsPerRouting;
+
+    return self;
+}
+
+- (double)throughput {
+    if (self.duration <= 0) return 0;
+
+    return self.routingCount / self.duration;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> routings: %lu, failures: %lu, duration: %.3fs, throughput: %.0f/s, p50: %.1fµs, p99: %.1fµs, p999: %.1fµs, allocations per routing: %.1f",
+        self.class,
+        self,
+        (unsigned long)self.routingCount,
+        (unsigned long)self.failureCount,
+        self.duration,
+        self.throughput,
+        self.latencyP50 * USEC_PER_SEC,
+        self.latencyP99 * USEC_PER_SEC,
+        self.latencyP999 * USEC_PER_SEC,
+        self.allocationsPerRouting];
+}
+
+@end
+
+@implementation AUTRoutingLoadGenerator
+
+#pragma mark - Lifecycle
+
+- (instancetype)init {
+    self = [super init];
+
+    _depth = 3;
+    _fanout = 8;
+    _staticRatio = 0.5;
+    _URLCount = 1000;
+    _threadCount = 1;
+    _seed = 1;
+
+    return self;
+}
+
+#pragma mark - AUTRoutingLoadGenerator
+
+- (AUTRoutingLoadResult *)run {
+    NSParameterAssert(self.depth > 1);
+    NSParameterAssert(self.fanout > 0);
+    NSParameterAssert(self.threadCount > 0);
+
+    // xorshift has a fixed point at zero.
+    uint64_t state = self.seed ?: 1;
+
+    let root = [[AUTRoutingLoadRoutable alloc] init];
+    [self addRoutesToRoutable:root depth:self.depth state:&state];
+
+    let urls = [self URLsInTreeWithRoot:root state:&state];
+
+    let threadCount = self.threadCount;
+    let urlCount = urls.count;
+    let routingCount = threadCount * urlCount;
+
+    NSTimeInterval *latencies = calloc(MAX(routingCount, 1), sizeof(NSTimeInterval));
+    __block atomic_ulong failureCount = 0;
+
+    let group = dispatch_group_create();
+    let queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+
+    StartCountingAllocations();
+    let startTime = AUTRoutingMonotonicTime();
+
+    for (NSUInteger thread = 0; thread < threadCount; thread++) {
+        let threadLatencies = latencies + thread * urlCount;
+
+        dispatch_group_async(group, queue, ^{
+            // The handleURL command subscribes on the main thread, which is
+            // blocked for the duration of the run, so routing is driven
+            // through the signal that backs it instead.
+            let scheduler = [RACScheduler schedulerWithPriority:RACSchedulerPriorityHigh name:@"com.automatic.AUTRouting.AUTRoutingLoadGenerator"];
+            let router = [[AUTRouter alloc] initWithRootRoutes:root.routes];
+            router.matchingScheduler = scheduler;
+            router.handlerScheduler = scheduler;
+
+            for (NSUInteger index = 0; index < urlCount; index++) {
+                @autoreleasepool {
+                    let routingStartTime = AUTRoutingMonotonicTime();
+
+                    let routing = [router routingSignalForURL:urls[index] context:nil];
+                    if (![routing waitUntilCompleted:NULL]) {
+                        atomic_fetch_add_explicit(&failureCount, 1, memory_order_relaxed);
+                    }
+
+                    threadLatencies[index] = AUTRoutingMonotonicTime() - routingStartTime;
+                }
+            }
+        });
+    }
+
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+
+    let duration = AUTRoutingMonotonicTime() - startTime;
+    let allocationCount = StopCountingAllocations();
+
+    qsort(latencies, routingCount, sizeof(NSTimeInterval), CompareTimeIntervals);
+
+    let result = [[AUTRoutingLoadResult alloc]
+        initWithRoutingCount:routingCount
+        failureCount:atomic_load(&failureCount)
+        duration:duration
+        latencyP50:Percentile(latencies, routingCount, 0.5)
+        latencyP99:Percentile(latencies, routingCount, 0.99)
+        latencyP999:Percentile(latencies, routingCount, 0.999)
+        allocationsPerRouting:(routingCount > 0 ? (double)allocationCount / routingCount : 0)];
+
+    free(latencies);
+
+    return result;
+}
+
+#pragma mark - Private
+
+/// Adds fanout routes to the provided routable, each sending a routable with
+/// routes of its own until the provided depth is exhausted.
+- (void)addRoutesToRoutable:(AUTRoutingLoadRoutable *)routable depth:(NSUInteger)depth state:(uint64_t *)state {
+    if (depth <= 1) return;
+
+    for (NSUInteger index = 0; index < self.fanout; index++) {
+        let nextRoutable = [[AUTRoutingLoadRoutable alloc] init];
+        [self addRoutesToRoutable:nextRoutable depth:depth - 1 state:state];
+
+        let component = [NSString stringWithFormat:@"r%lu", (unsigned long)index];
+        let routeComponents = (NextUniform(state) < self.staticRatio) ? @[ component ] : @[ component, @":token" ];
+
+        [routable.routes addRoute:routeComponents withSignal:[self handlerSignalSendingRoutable:nextRoutable state:state]];
+        [routable.routeComponents addObject:routeComponents];
+        [routable.nextRoutables addObject:nextRoutable];
+    }
+}
+
+/// Returns a signal that sends the provided routable after a latency drawn
+/// from the handler latency distribution.
+///
+/// Each route draws from a generator seeded from the provided state, indexed by
+/// the number of times that the route has been invoked, so that latencies are
+/// derived from the seed even as threads invoke the route concurrently.
+- (RACSignal<id<AUTRoutable>> *)handlerSignalSendingRoutable:(id<AUTRoutable>)routable state:(uint64_t *)state {
+    let signal = [RACSignal return:routable];
+
+    let handlerLatency = self.handlerLatency;
+    if (handlerLatency == nil) return signal;
+
+    let routeSeed = NextRandom(state);
+    __block atomic_ullong invocationCount = 0;
+
+    return [RACSignal defer:^{
+        let invocation = atomic_fetch_add_explicit(&invocationCount, 1, memory_order_relaxed);
+
+        // xorshift has a fixed point at zero.
+        uint64_t invocationState = MixRandom(routeSeed + invocation) ?: 1;
+
+        let latency = handlerLatency(NextUniform(&invocationState));
+        return (latency > 0) ? [signal delay:latency] : signal;
+    }];
+}
+
+/// Generates URLs by walking from the root to a leaf of the tree, choosing a
+/// random route at each routable.
+- (NSArray<NSURL *> *)URLsInTreeWithRoot:(AUTRoutingLoadRoutable *)root state:(uint64_t *)state {
+    let urls = [NSMutableArray<NSURL *> arrayWithCapacity:self.URLCount];
+
+    for (NSUInteger index = 0; index < self.URLCount; index++) {
+        let path = [NSMutableString stringWithString:@"load:"];
+        var routable = root;
+
+        while (routable.nextRoutables.count > 0) {
+            let routeIndex = NextRandom(state) % routable.nextRoutables.count;
+            let routeComponents = routable.routeComponents[routeIndex];
+
+            [path appendFormat:@"/%@", routeComponents.firstObject];
+            if (routeComponents.count > 1) {
+                [path appendFormat:@"/%llu", NextRandom(state) % 100000];
+            }
+
+            routable = routable.nextRoutables[routeIndex];
+        }
+
+        [urls addObject:AUTNotNil([NSURL URLWithString:path])];
+    }
+
+    return [urls copy];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
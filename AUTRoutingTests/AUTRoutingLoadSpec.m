@@ -0,0 +1,82 @@
+//
+//  AUTRoutingLoadSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTRoutingLoadGenerator.h"
+
+SpecBegin(AUTRoutingLoad)
+
+__block AUTRoutingLoadGenerator *generator;
+
+beforeEach(^{
+    generator = [[AUTRoutingLoadGenerator alloc] init];
+    generator.depth = 4;
+    generator.fanout = 6;
+    generator.URLCount = 200;
+});
+
+it(@"should route to every generated URL from a single thread", ^{
+    let result = [generator run];
+    expect(result.routingCount).to.equal(200);
+    expect(result.failureCount).to.equal(0);
+    expect(result.throughput).to.beGreaterThan(0);
+    expect(result.latencyP50).to.beLessThanOrEqualTo(result.latencyP99);
+    expect(result.latencyP99).to.beLessThanOrEqualTo(result.latencyP999);
+});
+
+it(@"should route to every generated URL from many threads", ^{
+    generator.threadCount = 4;
+    generator.staticRatio = 0.25;
+
+    let result = [generator run];
+    expect(result.routingCount).to.equal(800);
+    expect(result.failureCount).to.equal(0);
+});
+
+it(@"should route to every generated URL with handler latency", ^{
+    generator.URLCount = 20;
+    generator.handlerLatency = ^(double uniform) {
+        // Exponentially distributed with a mean of a millisecond.
+        return -log(1 - uniform) * 0.001;
+    };
+
+    let result = [generator run];
+    expect(result.failureCount).to.equal(0);
+    expect(result.latencyP50).to.beGreaterThan(0);
+});
+
+it(@"should generate URLs from route templates in bulk", ^{
+    let route = [[AUTRoute alloc] initWithComponents:@[ @"user", @":user_id", @"posts", @":post_id", @"?[ref]" ] handler:^(NSDictionary *parameters, NSURL *url) {
+        return [RACSignal empty];
+    }];
+
+    let count = 10000;
+    let parameters = [NSMutableArray<NSDictionary<NSString *, NSString *> *> arrayWithCapacity:count];
+    for (NSInteger index = 0; index < count; index++) {
+        [parameters addObject:@{
+            @"user_id": [NSString stringWithFormat:@"user %ld", (long)index],
+            @"post_id": [NSString stringWithFormat:@"%ld", (long)index * 7],
+            @"ref": @"share sheet",
+        }];
+    }
+
+    NSUInteger generatedCount = 0;
+    for (NSDictionary<NSString *, NSString *> *URLParameters in parameters) {
+        if ([route URLWithScheme:@"custom" parameters:URLParameters] != nil) generatedCount++;
+    }
+
+    expect(generatedCount).to.equal(count);
+
+    let url = [route URLWithScheme:@"custom" parameters:parameters.lastObject];
+    expect(url.aut_routingComponents).to.equal((@[ @"user", @"user 9999", @"posts", @"69993" ]));
+});
+
+SpecEnd
@@ -0,0 +1,99 @@
+//
+//  AUTRoutingQueueSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTStubRoutable.h"
+
+SpecBegin(AUTRoutingQueue)
+
+__block BOOL success;
+__block NSError *error;
+__block AUTStubRoutable *routable;
+__block AUTRouter *router;
+__block RACSubject *blocker;
+__block NSMutableArray<NSString *> *handledRoutes;
+
+beforeEach(^{
+    success = NO;
+    error = nil;
+
+    routable = [[AUTStubRoutable alloc] init];
+    router = [[AUTRouter alloc] initWithRootRoutes:routable.routes];
+
+    blocker = [RACSubject subject];
+    handledRoutes = [NSMutableArray array];
+
+    [routable.routes addRoute:@[ @"blocking" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+        return [blocker take:1];
+    }];
+
+    [routable.routes addRoute:@[ @"record" ] withSingleTokenHandler:^(NSString *name, NSURL *url) {
+        [handledRoutes addObject:name];
+        return [RACSignal empty];
+    }];
+});
+
+it(@"should route to queued URLs in priority order once capacity frees up", ^{
+    let queue = [[AUTRoutingQueue alloc] initWithRouter:router maxConcurrentRoutings:1 maxQueueDepth:0];
+
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/blocking"], nil, nil)];
+    expect(queue.activeRoutingCount).to.equal(1);
+
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/background"], nil, @(AUTRoutingPriorityBackground))];
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/default"], nil, nil)];
+    let lastExecution = [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/user"], nil, @(AUTRoutingPriorityUserInitiated))];
+    expect(queue.queueDepth).to.equal(3);
+    expect(queue.peakQueueDepth).to.equal(3);
+
+    [blocker sendNext:routable];
+
+    success = [lastExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal((@[ @"user", @"default", @"background" ]));
+    expect(queue.queueDepth).to.equal(0);
+    expect(queue.activeRoutingCount).to.equal(0);
+});
+
+it(@"should drop the newest URL when at capacity", ^{
+    let queue = [[AUTRoutingQueue alloc] initWithRouter:router maxConcurrentRoutings:1 maxQueueDepth:1];
+
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/blocking"], nil, nil)];
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/first"], nil, nil)];
+
+    let url = [NSURL URLWithString:@"custom:/record/second"];
+    success = [[queue.handleURL execute:RACTuplePack(url, nil, nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(error.domain).to.equal(AUTRoutingErrorDomain);
+    expect(error.code).to.equal(AUTRoutingErrorCodeDropped);
+    expect(error.userInfo[AUTRoutingErrorURLKey]).to.equal(url);
+    expect(queue.droppedCount).to.equal(1);
+});
+
+it(@"should replace the lowest priority URL when at capacity", ^{
+    let queue = [[AUTRoutingQueue alloc] initWithRouter:router maxConcurrentRoutings:1 maxQueueDepth:1];
+    queue.overflowPolicy = AUTRoutingQueueOverflowPolicyReplaceLowestPriority;
+
+    [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/blocking"], nil, nil)];
+    let backgroundExecution = [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/background"], nil, @(AUTRoutingPriorityBackground))];
+    let userExecution = [queue.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/record/user"], nil, @(AUTRoutingPriorityUserInitiated))];
+
+    success = [backgroundExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(error.code).to.equal(AUTRoutingErrorCodeDropped);
+
+    [blocker sendNext:routable];
+
+    success = [userExecution asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledRoutes).to.equal(@[ @"user" ]);
+});
+
+SpecEnd
@@ -0,0 +1,117 @@
+//
+//  AUTRoutingSnapshotSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTStubRoutable.h"
+
+SpecBegin(AUTRoutingSnapshot)
+
+__block BOOL success;
+__block NSError *error;
+__block AUTStubRoutable *routable;
+__block AUTStubRoutable *userRoutable;
+__block AUTRouter *router;
+__block NSMutableArray<NSString *> *handledRoutes;
+__block NSMutableArray *handledContexts;
+
+beforeEach(^{
+    success = NO;
+    error = nil;
+
+    routable = [[AUTStubRoutable alloc] init];
+    userRoutable = [[AUTStubRoutable alloc] init];
+    router = [[AUTRouter alloc] initWithRootRoutes:routable.routes];
+    router.recordsRoutingSnapshots = YES;
+
+    handledRoutes = [NSMutableArray array];
+    handledContexts = [NSMutableArray array];
+
+    [routable.routes addRoute:@[ @"user", @":user_id" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+        [handledRoutes addObject:[NSString stringWithFormat:@"user %@", parameters[@"user_id"]]];
+        return [RACSignal return:userRoutable];
+    }];
+
+    [userRoutable.routes addRoute:@[ @"likes", @"?[sort]" ] withContextClass:AUTRoutingRestorationContext.class handler:^(NSDictionary<NSString *, NSString *> *parameters, AUTRoutingRestorationContext *context, NSURL *url) {
+        [handledRoutes addObject:[NSString stringWithFormat:@"likes %@", parameters[@"sort"]]];
+        [handledContexts addObject:context];
+        return [RACSignal empty];
+    }];
+
+    [userRoutable.routes addRoute:@[ @"likes", @"?[sort]" ] withContextClass:NSString.class handler:^(NSDictionary<NSString *, NSString *> *parameters, NSString *context, NSURL *url) {
+        [handledRoutes addObject:[NSString stringWithFormat:@"likes %@", parameters[@"sort"]]];
+        [handledContexts addObject:context];
+        return [RACSignal empty];
+    }];
+});
+
+it(@"should record the resolved chain of the last successful routing", ^{
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1/likes?sort=recent"], @"context")] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+
+    let snapshot = router.lastRoutingSnapshot;
+    expect(snapshot.components).to.equal((@[ @"user", @"1", @"likes" ]));
+    expect(snapshot.hops).to.haveCountOf(2);
+    expect(snapshot.hops[0].routeIdentifier).to.equal(@"user/:user_id");
+    expect(snapshot.hops[0].parameters).to.equal((@{ @"user_id": @"1" }));
+    expect(snapshot.hops[1].componentOffset).to.equal(2);
+    expect(snapshot.hops[1].matchLength).to.equal(1);
+    expect(snapshot.hops[1].parameters).to.equal((@{ @"sort": @"recent" }));
+});
+
+it(@"should not record failed routing", ^{
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1/unknown"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(router.lastRoutingSnapshot).to.beNil();
+});
+
+it(@"should restore a snapshot without animation", ^{
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1/likes?sort=recent"], @"context")] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+
+    let snapshot = [[AUTRoutingSnapshot alloc] initWithJSONObject:AUTNotNil(router.lastRoutingSnapshot).JSONObject];
+    expect(snapshot).notTo.beNil();
+
+    [handledRoutes removeAllObjects];
+    [handledContexts removeAllObjects];
+
+    success = [[router restoreSnapshot:AUTNotNil(snapshot) context:@"context" animated:NO] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(error).to.beNil();
+    expect(handledRoutes).to.equal((@[ @"user 1", @"likes recent" ]));
+
+    AUTRoutingRestorationContext *context = handledContexts.lastObject;
+    expect(context.animated).to.beFalsy();
+    expect(context.context).to.equal(@"context");
+});
+
+it(@"should error if a route of the snapshot no longer exists", ^{
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1/likes"], @"context")] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+
+    [userRoutable.routes replaceRoutes:@[]];
+
+    success = [[router restoreSnapshot:AUTNotNil(router.lastRoutingSnapshot) context:nil animated:NO] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beFalsy();
+    expect(error.domain).to.equal(AUTRoutingErrorDomain);
+    expect(error.code).to.equal(AUTRoutingErrorCodeNoMatchFound);
+});
+
+it(@"should reject malformed JSON objects", ^{
+    expect([[AUTRoutingSnapshot alloc] initWithJSONObject:@{}]).to.beNil();
+    expect([[AUTRoutingSnapshot alloc] initWithJSONObject:@{
+        @"url": @"custom:/user",
+        @"components": @[ @"user" ],
+        @"root": @0,
+        @"hops": @[ @{ @"route": @"user", @"parameters": @{}, @"offset": @1, @"length": @1 } ],
+    }]).to.beNil();
+});
+
+SpecEnd
@@ -0,0 +1,57 @@
+//
+//  AUTRoutingTraceReplayer.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <AUTRouting/AUTRouting.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The outcome of replaying routing traces.
+@interface AUTRoutingTraceReplayResult : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithRoutingCount:(NSUInteger)routingCount failureCount:(NSUInteger)failureCount duration:(NSTimeInterval)duration NS_DESIGNATED_INITIALIZER;
+
+/// The number of URLs that were routed to.
+@property (readonly, nonatomic) NSUInteger routingCount;
+
+/// The number of URLs that failed to route.
+@property (readonly, nonatomic) NSUInteger failureCount;
+
+/// The total time spent routing.
+@property (readonly, nonatomic) NSTimeInterval duration;
+
+/// The number of URLs routed to per second.
+@property (readonly, nonatomic) double routingsPerSecond;
+
+@end
+
+/// Replays routing traces at full speed against a synthetic routing tree that
+/// is rebuilt from the traces, to benchmark matching and the routing driver
+/// with a realistic mix of URLs and hops.
+///
+/// The synthetic tree contains a route for each hop that was matched in the
+/// traces, and every route handler sends its next routable synchronously so
+/// that handler latency is excluded from the benchmark.
+@interface AUTRoutingTraceReplayer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @param records The traces to replay, e.g. as read from a file with
+///        +[AUTRoutingTraceRecorder recordsWithContentsOfURL:error:].
+- (instancetype)initWithRecords:(NSArray<AUTRoutingTraceRecord *> *)records NS_DESIGNATED_INITIALIZER;
+
+/// The root routes of the synthetic routing tree.
+@property (readonly, nonatomic) AUTRoutes *rootRoutes;
+
+/// Routes to the URL of every record the provided number of times, blocking
+/// until finished.
+- (AUTRoutingTraceReplayResult *)replayWithIterations:(NSUInteger)iterations;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,163 @@
+//
+//  AUTRoutingTraceReplayer.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <ReactiveObjC/ReactiveObjC.h>
+#import <AUTRouting/AUTRouter_Private.h>
+#import <AUTRouting/AUTRoutingTime.h>
+
+#import "AUTExtObjC.h"
+#import "AUTStubRoutable.h"
+
+#import "AUTRoutingTraceReplayer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The scheme of the URLs that are replayed.
+static let ReplayURLScheme = @"aut-replay";
+
+/// Builds a URL whose routing components are the provided components, or nil
+/// if there are no components.
+static NSURL * _Nullable ReplayURL(NSArray<NSString *> *components) {
+    if (components.count == 0) return nil;
+
+    static NSCharacterSet *allowedCharacters;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSMutableCharacterSet *characters = [NSCharacterSet.URLPathAllowedCharacterSet mutableCopy];
+        [characters removeCharactersInString:@"/"];
+        allowedCharacters = [characters copy];
+    });
+
+    let path = [NSMutableString string];
+    for (NSString *component in components) {
+        [path appendFormat:@"/%@", [component stringByAddingPercentEncodingWithAllowedCharacters:allowedCharacters] ?: @""];
+    }
+
+    return [NSURL URLWithString:[NSString stringWithFormat:@"%@:%@", ReplayURLScheme, path]];
+}
+
+@implementation AUTRoutingTraceReplayResult
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRoutingCount:(NSUInteger)routingCount failureCount:(NSUInteger)failureCount duration:(NSTimeInterval)duration {
+    self = [super init];
+
+    _routingCount = routingCount;
+    _failureCount = failureCount;
+    _duration = duration;
+
+    return self;
+}
+
+- (double)routingsPerSecond {
+    if (self.duration <= 0) return 0;
+
+    return self.routingCount / self.duration;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> routings: %lu, failures: %lu, duration: %.6fs, routings per second: %.0f", self.class, self, (unsigned long)self.routingCount, (unsigned long)self.failureCount, self.duration, self.routingsPerSecond];
+}
+
+@end
+
+@interface AUTRoutingTraceReplayer ()
+
+/// Every node in the synthetic routing tree, keyed by the joined route
+/// components of the hops leading to it. Retains the tree.
+@property (readonly, nonatomic, copy) NSDictionary<NSString *, AUTStubRoutable *> *routables;
+
+/// The URL of each of the records, in order.
+@property (readonly, nonatomic, copy) NSArray<NSURL *> *URLs;
+
+@end
+
+@implementation AUTRoutingTraceReplayer
+
+#pragma mark - Lifecycle
+
+- (instancetype)init AUT_UNAVAILABLE_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithRecords:(NSArray<AUTRoutingTraceRecord *> *)records {
+    AUTAssertNotNil(records);
+
+    self = [super init];
+
+    let root = [[AUTStubRoutable alloc] init];
+    let routables = [NSMutableDictionary<NSString *, AUTStubRoutable *> dictionaryWithObject:root forKey:@""];
+    let urls = [NSMutableArray<NSURL *> arrayWithCapacity:records.count];
+
+    for (AUTRoutingTraceRecord *record in records) {
+        var routable = root;
+        var path = @"";
+
+        for (AUTRoutingTraceHop *hop in record.hops) {
+            // Hops that failed to match have no route to rebuild.
+            if (hop.routeComponents.count == 0) break;
+
+            // Replayed URLs have no query, so routes are rebuilt without any
+            // query keys that they declared.
+            let routeComponents = [hop.routeComponents filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"NOT SELF BEGINSWITH '?'"]];
+
+            path = [path stringByAppendingFormat:@"\n%@", [routeComponents componentsJoinedByString:@"/"]];
+
+            var nextRoutable = routables[path];
+            if (nextRoutable == nil) {
+                nextRoutable = [[AUTStubRoutable alloc] init];
+                routables[path] = nextRoutable;
+            }
+
+            // Routes seen in earlier records are rejected as duplicates, and
+            // already send the same next routable.
+            [routable.routes addRoute:routeComponents withSignal:[RACSignal return:nextRoutable]];
+
+            routable = AUTNotNil(nextRoutable);
+        }
+
+        let url = ReplayURL(record.components);
+        if (url != nil) [urls addObject:AUTNotNil(url)];
+    }
+
+    _rootRoutes = root.routes;
+    _routables = [routables copy];
+    _URLs = [urls copy];
+
+    return self;
+}
+
+#pragma mark - AUTRoutingTraceReplayer
+
+- (AUTRoutingTraceReplayResult *)replayWithIterations:(NSUInteger)iterations {
+    let router = [[AUTRouter alloc] initWithRootRoutes:self.rootRoutes];
+
+    NSUInteger routingCount = 0;
+    NSUInteger failureCount = 0;
+
+    let startTime = AUTRoutingMonotonicTime();
+
+    for (NSUInteger iteration = 0; iteration < iterations; iteration++) {
+        @autoreleasepool {
+            for (NSURL *url in self.URLs) {
+                NSError *error;
+                if (![[router routingSignalForURL:url context:nil] waitUntilCompleted:&error]) {
+                    failureCount++;
+                }
+
+                routingCount++;
+            }
+        }
+    }
+
+    let duration = AUTRoutingMonotonicTime() - startTime;
+
+    return [[AUTRoutingTraceReplayResult alloc] initWithRoutingCount:routingCount failureCount:failureCount duration:duration];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
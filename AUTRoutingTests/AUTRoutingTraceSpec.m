@@ -0,0 +1,138 @@
+//
+//  AUTRoutingTraceSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTRoutingTraceReplayer.h"
+#import "AUTStubRoutable.h"
+
+static AUTRoutingTraceRecord *StubRecord(NSArray<NSString *> *components) {
+    let hop = [[AUTRoutingTraceHop alloc] initWithRouteComponents:components matchLength:components.count matchDuration:0.001 handlerDuration:0.002];
+    return [[AUTRoutingTraceRecord alloc] initWithComponents:components hops:@[ hop ] duration:0.003 succeeded:YES errorCode:0];
+}
+
+SpecBegin(AUTRoutingTrace)
+
+__block AUTRoutingTraceRecorder *recorder;
+
+beforeEach(^{
+    recorder = [[AUTRoutingTraceRecorder alloc] initWithCapacity:2];
+});
+
+describe(@"recording traces", ^{
+    it(@"should retain the newest records up to its capacity, oldest first", ^{
+        [recorder addRecord:StubRecord(@[ @"a" ])];
+        [recorder addRecord:StubRecord(@[ @"b" ])];
+        [recorder addRecord:StubRecord(@[ @"c" ])];
+
+        expect(recorder.records).to.haveCountOf(2);
+        expect(recorder.records[0].components).to.equal(@[ @"b" ]);
+        expect(recorder.records[1].components).to.equal(@[ @"c" ]);
+    });
+
+    it(@"should record the hops of routing performed by a router", ^{
+        let routable = [[AUTStubRoutable alloc] init];
+        let nextRoutable = [[AUTStubRoutable alloc] init];
+        [routable.routes addRoute:@[ @"state", @":token" ] withSignal:[RACSignal return:nextRoutable]];
+        [nextRoutable.routes addRoute:@[ @"city" ] withSignal:[RACSignal empty]];
+
+        let router = [[AUTRouter alloc] initWithRootRoutes:routable.routes];
+        router.traceRecorder = recorder;
+
+        let url = [[NSURL alloc] initWithString:@"custom:/state/ca/city"];
+        BOOL success = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronouslyWaitUntilCompleted:NULL];
+        expect(success).to.beTruthy();
+
+        expect(recorder.records).to.haveCountOf(1);
+
+        let record = recorder.records.firstObject;
+        expect(record.components).to.equal((@[ @"state", @"ca", @"city" ]));
+        expect(record.succeeded).to.beTruthy();
+        expect(record.hops).to.haveCountOf(2);
+        expect(record.hops[0].routeComponents).to.equal((@[ @"state", @":token" ]));
+        expect(record.hops[0].matchLength).to.equal(2);
+        expect(record.hops[1].routeComponents).to.equal(@[ @"city" ]);
+    });
+
+    it(@"should record the error code of failed routing", ^{
+        let routable = [[AUTStubRoutable alloc] init];
+        let router = [[AUTRouter alloc] initWithRootRoutes:routable.routes];
+        router.traceRecorder = recorder;
+
+        let url = [[NSURL alloc] initWithString:@"custom:/state"];
+        BOOL success = [[router.handleURL execute:RACTuplePack(url, nil)] asynchronouslyWaitUntilCompleted:NULL];
+        expect(success).to.beFalsy();
+
+        let record = recorder.records.firstObject;
+        expect(record.succeeded).to.beFalsy();
+        expect(record.errorCode).to.equal(AUTRoutingErrorCodeNoMatchFound);
+    });
+});
+
+describe(@"trace files", ^{
+    it(@"should read back the records that were written", ^{
+        [recorder addRecord:StubRecord(@[ @"state", @"new york" ])];
+        [recorder addRecord:StubRecord(@[ @"a/b" ])];
+
+        let url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+
+        NSError *error;
+        expect([recorder writeToURL:url error:&error]).to.beTruthy();
+        expect(error).to.beNil();
+
+        let records = [AUTRoutingTraceRecorder recordsWithContentsOfURL:url error:&error];
+        expect(error).to.beNil();
+        expect(records).to.haveCountOf(2);
+        expect(records[0].components).to.equal((@[ @"state", @"new york" ]));
+        expect(records[1].components).to.equal(@[ @"a/b" ]);
+        expect(records[1].hops.firstObject.routeComponents).to.equal(@[ @"a/b" ]);
+        expect(records[1].succeeded).to.beTruthy();
+
+        [NSFileManager.defaultManager removeItemAtURL:url error:NULL];
+    });
+
+    it(@"should error when reading a file that is not a trace file", ^{
+        let url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+        [@"not a trace" writeToURL:url atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+
+        NSError *error;
+        let records = [AUTRoutingTraceRecorder recordsWithContentsOfURL:url error:&error];
+        expect(records).to.beNil();
+        expect(error.domain).to.equal(NSCocoaErrorDomain);
+
+        [NSFileManager.defaultManager removeItemAtURL:url error:NULL];
+    });
+});
+
+describe(@"replaying traces", ^{
+    it(@"should route to every recorded URL for each iteration", ^{
+        let records = @[
+            StubRecord(@[ @"state", @"ca" ]),
+            [[AUTRoutingTraceRecord alloc]
+                initWithComponents:@[ @"state", @"ny", @"city" ]
+                hops:@[
+                    [[AUTRoutingTraceHop alloc] initWithRouteComponents:@[ @"state", @":token" ] matchLength:2 matchDuration:0 handlerDuration:0],
+                    [[AUTRoutingTraceHop alloc] initWithRouteComponents:@[ @"city" ] matchLength:1 matchDuration:0 handlerDuration:0],
+                ]
+                duration:0
+                succeeded:YES
+                errorCode:0],
+        ];
+
+        let replayer = [[AUTRoutingTraceReplayer alloc] initWithRecords:records];
+        let result = [replayer replayWithIterations:3];
+
+        expect(result.routingCount).to.equal(6);
+        expect(result.failureCount).to.equal(0);
+        expect(replayer.rootRoutes.routes).to.haveCountOf(2);
+    });
+});
+
+SpecEnd
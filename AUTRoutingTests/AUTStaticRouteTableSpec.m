@@ -0,0 +1,189 @@
+//
+//  AUTStaticRouteTableSpec.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <specta/specta.h>
+#import <expecta/expecta.h>
+#import <AUTRouting/AUTRouting.h>
+
+#import "AUTExtObjC.h"
+#import "AUTRoutableConformance.h"
+#import "AUTRoutes_Private.h"
+#import "AUTStubRoutable.h"
+
+static id _Nullable HandledTarget;
+static NSMutableArray<NSDictionary<NSString *, NSString *> *> *HandledParameters;
+
+static RACSignal<id<AUTRoutable>> *HandleUser(id _Nullable target, NSDictionary<NSString *, NSString *> *parameters, id _Nullable context, NSURL *url) {
+    HandledTarget = target;
+    [HandledParameters addObject:parameters];
+    return [RACSignal empty];
+}
+
+static RACSignal<id<AUTRoutable>> *HandleInbox(id _Nullable target, NSDictionary<NSString *, NSString *> *parameters, id _Nullable context, NSURL *url) {
+    HandledTarget = target;
+    [HandledParameters addObject:parameters];
+    return [RACSignal empty];
+}
+
+AUT_STATIC_ROUTE_TABLE(SpecRouteTable,
+    AUT_STATIC_ROUTE(HandleUser, "user", ":user_id"),
+    AUT_STATIC_ROUTE(HandleInbox, "inbox", "?[tab]"))
+
+/// A routable that has no routes of its own, only a route template.
+@interface AUTStubTemplateRoutable : NSObject <AUTTemplateRoutable>
+@end
+
+@implementation AUTStubTemplateRoutable
+
++ (AUTStaticRouteTable *)routeTemplate {
+    return SpecRouteTable();
+}
+
+@end
+
+SpecBegin(AUTStaticRouteTable)
+
+__block BOOL success;
+__block NSError *error;
+__block AUTStubRoutable *routable;
+__block AUTRoutes *routes;
+__block AUTRouter *router;
+
+beforeEach(^{
+    success = NO;
+    error = nil;
+
+    HandledTarget = nil;
+    HandledParameters = [NSMutableArray array];
+
+    routable = [[AUTStubRoutable alloc] init];
+    routes = [[AUTRoutes alloc] initWithStaticRouteTable:SpecRouteTable() target:routable];
+    router = [[AUTRouter alloc] initWithRootRoutes:routes];
+});
+
+it(@"should create the routes of a table once", ^{
+    expect(SpecRouteTable().count).to.equal(2);
+    expect(SpecRouteTable().routes).to.haveCountOf(2);
+    expect(SpecRouteTable().routes.firstObject).to.beIdenticalTo(SpecRouteTable().routes.firstObject);
+    expect(SpecRouteTable().routes.firstObject.identifier).to.equal(@"user/:user_id");
+});
+
+it(@"should share a table between routes", ^{
+    let otherRoutes = [[AUTRoutes alloc] initWithStaticRouteTable:SpecRouteTable() target:nil];
+
+    expect([routes routeWithIdentifier:@"user/:user_id"]).to.beIdenticalTo([otherRoutes routeWithIdentifier:@"user/:user_id"]);
+});
+
+it(@"should count the table's routes separately for each routes", ^{
+    let otherRoutes = [[AUTRoutes alloc] initWithStaticRouteTable:SpecRouteTable() target:nil];
+    let otherRouter = [[AUTRouter alloc] initWithRootRoutes:otherRoutes];
+
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    success = [[otherRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/2"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    success = [[otherRouter.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/3"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+
+    expect(routes.routeStatistics[0].routeIdentifier).to.equal(@"user/:user_id");
+    expect(routes.routeStatistics[0].hitCount).to.equal(1);
+    expect(otherRoutes.routeStatistics[0].hitCount).to.equal(2);
+
+    [otherRoutes resetRouteStatistics];
+    expect(routes.routeStatistics[0].hitCount).to.equal(1);
+    expect(otherRoutes.routeStatistics[0].hitCount).to.equal(0);
+});
+
+it(@"should invoke handlers with the target and parameters", ^{
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/user/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(error).to.beNil();
+
+    expect(HandledTarget).to.beIdenticalTo(routable);
+    expect(HandledParameters).to.equal((@[ @{ @"user_id": @"1" } ]));
+});
+
+it(@"should layer added routes on top of the table", ^{
+    __block BOOL handledSettings = NO;
+    [routes addRoute:@[ @"settings" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+        handledSettings = YES;
+        return [RACSignal empty];
+    }];
+
+    expect(routes.routes).to.haveCountOf(3);
+
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/settings"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(handledSettings).to.beTruthy();
+
+    routes.ordersRoutesByHits = YES;
+
+    success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/inbox?tab=unread"], nil)] asynchronouslyWaitUntilCompleted:&error];
+    expect(success).to.beTruthy();
+    expect(HandledParameters).to.equal((@[ @{ @"tab": @"unread" } ]));
+});
+
+it(@"should reject added routes that are in the table", ^{
+    let route = [routes addRoute:@[ @"user", @":user_id" ] withHandler:^(NSDictionary<NSString *, NSString *> *parameters, NSURL *url) {
+        return [RACSignal empty];
+    }];
+
+    expect(route).to.beNil();
+    expect(routes.routes).to.haveCountOf(2);
+});
+
+it(@"should keep the table's routes when routes are removed or replaced", ^{
+    [routes removeRoute:AUTNotNil([routes routeWithIdentifier:@"user/:user_id"])];
+    expect(routes.routes).to.haveCountOf(2);
+
+    let rejectedRoutes = [routes replaceRoutes:@[]];
+    expect(rejectedRoutes).to.haveCountOf(0);
+    expect(routes.routes).to.haveCountOf(2);
+});
+
+describe(@"route templates", ^{
+    __block AUTStubTemplateRoutable *firstRoutable;
+    __block AUTStubTemplateRoutable *secondRoutable;
+
+    beforeEach(^{
+        firstRoutable = [[AUTStubTemplateRoutable alloc] init];
+        secondRoutable = [[AUTStubTemplateRoutable alloc] init];
+
+        [routes addRoute:@[ @"first" ] withSignal:[RACSignal return:firstRoutable]];
+        [routes addRoute:@[ @"second" ] withSignal:[RACSignal return:secondRoutable]];
+    });
+
+    it(@"should dispatch through the template with the instance as the target", ^{
+        success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/first/user/1"], nil)] asynchronouslyWaitUntilCompleted:&error];
+        expect(success).to.beTruthy();
+        expect(HandledTarget).to.beIdenticalTo(firstRoutable);
+
+        success = [[router.handleURL execute:RACTuplePack([NSURL URLWithString:@"custom:/second/user/2"], nil)] asynchronouslyWaitUntilCompleted:&error];
+        expect(success).to.beTruthy();
+        expect(HandledTarget).to.beIdenticalTo(secondRoutable);
+
+        expect(HandledParameters).to.equal((@[ @{ @"user_id": @"1" }, @{ @"user_id": @"2" } ]));
+    });
+
+    it(@"should treat instances of template routable classes as routable", ^{
+        expect(AUTIsRoutable(firstRoutable)).to.beTruthy();
+        expect(AUTRoutableConformanceOfObject(firstRoutable)).to.equal(AUTRoutableConformanceTemplateRoutable);
+        expect(AUTRoutableConformanceOfObject(routable)).to.equal(AUTRoutableConformanceRoutable);
+        expect(AUTRoutableConformanceOfObject(@"not routable")).to.equal(AUTRoutableConformanceNone);
+        expect([firstRoutable conformsToProtocol:@protocol(AUTRoutable)]).to.beFalsy();
+    });
+
+    it(@"should share the template's routes between instances", ^{
+        let templateRoutes = [AUTRoutes templateRoutesForRoutableClass:AUTStubTemplateRoutable.class];
+
+        expect([AUTRoutes templateRoutesForRoutableClass:AUTStubTemplateRoutable.class]).to.beIdenticalTo(templateRoutes);
+        expect(templateRoutes.staticRouteTable).to.beIdenticalTo(SpecRouteTable());
+        expect(templateRoutes.target).to.beNil();
+    });
+});
+
+SpecEnd
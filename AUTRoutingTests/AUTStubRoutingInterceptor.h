@@ -0,0 +1,24 @@
+//
+//  AUTStubRoutingInterceptor.h
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import <AUTRouting/AUTRouting.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An interceptor that forwards each invocation to an optional block, leaving
+/// routing unchanged if no block is provided.
+@interface AUTStubRoutingInterceptor : NSObject <AUTRoutingInterceptor>
+
+@property (nonatomic, copy, nullable) NSURL * _Nullable (^willTokenizeURL)(NSURL *url, NSMutableDictionary<NSString *, id> *annotations, NSError **error);
+
+@property (nonatomic, copy, nullable) NSArray<NSString *> * _Nullable (^willHandleComponents)(NSArray<NSString *> *components, NSMutableDictionary<NSString *, id> *annotations, NSError **error);
+
+@property (nonatomic, copy, nullable) void (^didHandleComponents)(NSArray<NSString *> *components, id<AUTRoutable> _Nullable routable, NSMutableDictionary<NSString *, id> *annotations);
+
+@end
+
+NS_ASSUME_NONNULL_END
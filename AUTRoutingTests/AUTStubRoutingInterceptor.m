@@ -0,0 +1,34 @@
+//
+//  AUTStubRoutingInterceptor.m
+//  AUTRouting
+//
+//  Copyright © 2026 Automatic Labs. All rights reserved.
+//
+
+#import "AUTStubRoutingInterceptor.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation AUTStubRoutingInterceptor
+
+- (nullable NSURL *)router:(AUTRouter *)router willTokenizeURL:(NSURL *)url context:(nullable id)context annotations:(NSMutableDictionary<NSString *, id> *)annotations error:(NSError **)error {
+    if (self.willTokenizeURL == nil) return url;
+
+    return self.willTokenizeURL(url, annotations, error);
+}
+
+- (nullable NSArray<NSString *> *)router:(AUTRouter *)router willHandleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes context:(nullable id)context URL:(NSURL *)url annotations:(NSMutableDictionary<NSString *, id> *)annotations error:(NSError **)error {
+    if (self.willHandleComponents == nil) return components;
+
+    return self.willHandleComponents(components, annotations, error);
+}
+
+- (void)router:(AUTRouter *)router didHandleComponents:(NSArray<NSString *> *)components withRoutes:(AUTRoutes *)routes nextRoutable:(nullable id<AUTRoutable>)routable remainingComponents:(nullable NSArray<NSString *> *)remainingComponents context:(nullable id)context URL:(NSURL *)url annotations:(NSMutableDictionary<NSString *, id> *)annotations {
+    if (self.didHandleComponents == nil) return;
+
+    self.didHandleComponents(components, routable, annotations);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -44,4 +44,86 @@ it(@"should indicate that url with path components routable", ^{
     expect(url.aut_isRoutable).to.beTruthy();
 });
 
+describe(@"query parameters", ^{
+    it(@"should parse decoded query parameters", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"custom:/inbox?tab=2&ref=push%20alert&flag&tab=3#top"]);
+
+        expect(url.aut_queryParameters).to.equal((@{ @"tab": @"2", @"ref": @"push alert", @"flag": @"" }));
+    });
+
+    it(@"should have no query parameters without a query", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"custom:/inbox"]);
+
+        expect(url.aut_queryParameters).to.equal(@{});
+    });
+});
+
+describe(@"tokenizing with options", ^{
+    it(@"should produce the same components as without options for path parameters", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"https://example.com/vehicles/C_123;type=car/timeline"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(@[ @"example.com", @"vehicles", @"C_123" ]);
+        expect(url.aut_routingComponents).to.equal([url aut_routingComponentsWithOptions:0]);
+    });
+
+    it(@"should produce the same components as without options for percent-encoded slashes", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"custom:/files/a%2Fb/c"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(@[ @"files", @"a/b", @"c" ]);
+        expect(url.aut_routingComponents).to.equal([url aut_routingComponentsWithOptions:0]);
+    });
+
+    it(@"should produce the same components as without options for non-hierarchical URLs", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"custom:files/c"]);
+
+        expect(url.aut_routingComponents).to.equal([url aut_routingComponentsWithOptions:0]);
+        expect(url.aut_isRoutable).to.equal([url aut_routingComponentsWithOptions:0].count > 0);
+    });
+
+    it(@"should produce the same components as without options", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"https://mobile.automatic.com/vehicles/C_123/timeline/location/?tab=2#top"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(url.aut_routingComponents);
+    });
+
+    it(@"should produce components for a URL without a host", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"custom:/state/city"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(@[ @"state", @"city" ]);
+    });
+
+    it(@"should percent-decode components", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"https://example.com/cities/new%20york/caf%C3%A9"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(@[ @"example.com", @"cities", @"new york", @"café" ]);
+    });
+
+    it(@"should leave invalid percent escapes undecoded", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"https://example.com/%FF"]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal(@[ @"example.com", @"%FF" ]);
+    });
+
+    it(@"should fold the case of the host", ^{
+        let url = AUTNotNil([NSURL URLWithString:@"https://App.Example.com/Inbox"]);
+
+        expect([url aut_routingComponentsWithOptions:AUTRoutingTokenizerOptionFoldHostCase]).to.equal(@[ @"app.example.com", @"Inbox" ]);
+    });
+
+    it(@"should normalize decoded components", ^{
+        // "e" followed by a combining acute accent.
+        let url = AUTNotNil([NSURL URLWithString:@"https://example.com/cafe%CC%81"]);
+
+        let components = [url aut_routingComponentsWithOptions:AUTRoutingTokenizerOptionNormalizeUnicode];
+        expect(components.lastObject).to.equal(@"caf\u00e9");
+    });
+
+    it(@"should tokenize a URL longer than the stack buffer", ^{
+        let component = [@"" stringByPaddingToLength:600 withString:@"a" startingAtIndex:0];
+        let url = AUTNotNil([NSURL URLWithString:[NSString stringWithFormat:@"custom:/%@/b", component]]);
+
+        expect([url aut_routingComponentsWithOptions:0]).to.equal((@[ component, @"b" ]));
+    });
+});
+
 SpecEnd